@@ -12,202 +12,14 @@
 #include <string.h>
 #include <time.h>
 
-// ============================================================================
-// CONSTANTES
-// ============================================================================
-#define MAX_NOME 30
-#define MAX_COR 10
-#define DADOS_ATAQUE 6 // Simulação de dados (1 a 6)
-
-// ============================================================================
-// ESTRUTURA: Territorio
-// Armazena informações sobre um território no jogo de guerra
-// ============================================================================
-typedef struct
-{
-    char nome[MAX_NOME]; // Nome do território
-    char cor[MAX_COR];   // Cor do exército que controla o território
-    int tropas;          // Quantidade de tropas no território
-} Territorio;
-
-// ============================================================================
-// FUNÇÃO: lancarDado
-// DESCRIÇÃO: Simula o lançamento de um dado de 6 faces
-// RETORNO: número aleatório entre 1 e 6
-// ============================================================================
-int lancarDado()
-{
-    return (rand() % DADOS_ATAQUE) + 1;
-}
-
-// ============================================================================
-// FUNÇÃO: cadastrarTerritorios
-// DESCRIÇÃO: Solicita ao usuário informações dos territórios
-// PARÂMETROS: ponteiro para array de Territorio, quantidade de territórios
-// ============================================================================
-void cadastrarTerritorios(Territorio *territorios, int quantidade)
-{
-    printf("\n");
-    printf("╔════════════════════════════════════════════════╗\n");
-    printf("║    CADASTRO DE TERRITÓRIOS - %d REGIÕES       ║\n", quantidade);
-    printf("╚════════════════════════════════════════════════╝\n\n");
-
-    for (int i = 0; i < quantidade; i++)
-    {
-        printf("--- Território %d de %d ---\n", i + 1, quantidade);
-
-        printf("Digite o nome do território: ");
-        fgets(territorios[i].nome, MAX_NOME, stdin);
-        territorios[i].nome[strcspn(territorios[i].nome, "\n")] = '\0';
-
-        printf("Digite a cor do exército: ");
-        fgets(territorios[i].cor, MAX_COR, stdin);
-        territorios[i].cor[strcspn(territorios[i].cor, "\n")] = '\0';
-
-        printf("Digite a quantidade de tropas: ");
-        scanf("%d", &territorios[i].tropas);
-        getchar(); // Limpa o buffer de entrada
-
-        printf("\n");
-    }
-}
-
-// ============================================================================
-// FUNÇÃO: exibirTerritorios
-// DESCRIÇÃO: Exibe as informações de todos os territórios cadastrados
-// PARÂMETROS: ponteiro para array de Territorio, quantidade de territórios
-// ============================================================================
-void exibirTerritorios(Territorio *territorios, int quantidade)
-{
-    printf("\n");
-    printf("╔════════════════════════════════════════════════╗\n");
-    printf("║        TERRITÓRIOS CADASTRADOS - RESUMO        ║\n");
-    printf("╚════════════════════════════════════════════════╝\n\n");
-
-    for (int i = 0; i < quantidade; i++)
-    {
-        printf("┌────────────────────────────────────────────┐\n");
-        printf("│ Território %d [ID: %d]                      │\n", i + 1, i);
-        printf("├────────────────────────────────────────────┤\n");
-        printf("│ Nome:  %-35s │\n", territorios[i].nome);
-        printf("│ Cor:   %-35s │\n", territorios[i].cor);
-        printf("│ Tropas: %-34d │\n", territorios[i].tropas);
-        printf("└────────────────────────────────────────────┘\n\n");
-    }
-}
-
-// ============================================================================
-// FUNÇÃO: selecionarTerritorio
-// DESCRIÇÃO: Solicita ao usuário a seleção de um território com validação
-// PARÂMETROS: quantidade de territórios disponíveis, mensagem de seleção
-// RETORNO: índice do território selecionado
-// ============================================================================
-int selecionarTerritorio(int quantidade, const char *mensagem)
-{
-    int territorio;
-
-    while (1)
-    {
-        printf("%s", mensagem);
-        scanf("%d", &territorio);
-        getchar();
-
-        // Validação de entrada
-        if (territorio < 0 || territorio >= quantidade)
-        {
-            printf("❌ Seleção inválida! Digite um ID entre 0 e %d.\n\n", quantidade - 1);
-        }
-        else
-        {
-            return territorio;
-        }
-    }
-}
+#include "war_core.h"
 
 // ============================================================================
-// FUNÇÃO: atacar
-// DESCRIÇÃO: Simula um ataque entre dois territórios
-// PARÂMETROS: ponteiros para territórios atacante e defensor
-// NOTA: O resultado do ataque altera os dados do território defensor
+// PROTÓTIPOS DAS FUNÇÕES
+// Cadastro, exibição, seleção e ataque vêm do núcleo compartilhado (war_core.h)
 // ============================================================================
-void atacar(Territorio *atacante, Territorio *defensor)
-{
-    printf("\n");
-    printf("╔════════════════════════════════════════════════╗\n");
-    printf("║            SIMULAÇÃO DE ATAQUE                 ║\n");
-    printf("╚════════════════════════════════════════════════╝\n\n");
-
-    // Validação: não atacar próprio território
-    if (strcmp(atacante->cor, defensor->cor) == 0)
-    {
-        printf("❌ ERRO: Você não pode atacar um território de sua própria cor!\n\n");
-        return;
-    }
-
-    // Verificar se atacante tem tropas
-    if (atacante->tropas <= 0)
-    {
-        printf("❌ ERRO: O território atacante não tem tropas!\n\n");
-        return;
-    }
-
-    printf("🎲 %s [%s] (%d tropas) atacando %s [%s] (%d tropas)...\n\n",
-           atacante->nome, atacante->cor, atacante->tropas,
-           defensor->nome, defensor->cor, defensor->tropas);
-
-    // Lançar dados
-    int dadoAtacante = lancarDado();
-    int dadoDefensor = lancarDado();
-
-    printf("🎲 Dados de ataque:\n");
-    printf("   • %s [%s] lançou: %d\n", atacante->nome, atacante->cor, dadoAtacante);
-    printf("   • %s [%s] lançou: %d\n\n", defensor->nome, defensor->cor, dadoDefensor);
-
-    // Determinar resultado do ataque
-    if (dadoAtacante > dadoDefensor)
-    {
-        printf("✅ VITÓRIA! %s conquistou %s!\n\n", atacante->nome, defensor->nome);
-
-        // Calcula tropas transferidas (metade das tropas do defensor)
-        int tropasTransferidas = defensor->tropas / 2;
-
-        // Atualizar territórios
-        // Defensor perde todas as tropas
-        defensor->tropas = tropasTransferidas;
-
-        // Atacante ganha metade das tropas do defensor (que permanece no defensor)
-        // e transfere sua cor para o defensor
-        strcpy(defensor->cor, atacante->cor);
-
-        printf("📊 Resultado:\n");
-        printf("   • %s agora controla %s!\n", atacante->cor, defensor->nome);
-        printf("   • Tropas transferidas: %d\n", tropasTransferidas);
-        printf("   • Novas tropas em %s: %d\n\n", defensor->nome, defensor->tropas);
-    }
-    else if (dadoAtacante < dadoDefensor)
-    {
-        printf("❌ DERROTA! %s repeliu o ataque de %s!\n\n",
-               defensor->nome, atacante->nome);
-
-        // Atacante perde uma tropa
-        if (atacante->tropas > 0)
-        {
-            atacante->tropas--;
-            printf("📊 Resultado:\n");
-            printf("   • %s perdeu 1 tropa na batalha.\n", atacante->nome);
-            printf("   • Tropas restantes em %s: %d\n\n", atacante->nome, atacante->tropas);
-        }
-        else
-        {
-            printf("⚠️  %s não tinha tropas para perder!\n\n", atacante->nome);
-        }
-    }
-    else
-    {
-        printf("🤝 EMPATE! Nenhum território muda de controle.\n");
-        printf("   • %s mantém %s\n\n", defensor->cor, defensor->nome);
-    }
-}
+void liberarMemoria(Territorio *mapa);
+void exibirMenu();
 
 // ============================================================================
 // FUNÇÃO: liberarMemoria
@@ -247,7 +59,8 @@ void exibirMenu()
 int main()
 {
     // Inicializar o gerador de números aleatórios
-    srand(time(NULL));
+    semearAleatorio((unsigned long long)time(NULL));
+    usarRegras(&REGRAS_AVENTUREIRO);
 
     int quantidade = 0;
     Territorio *mapa = NULL;
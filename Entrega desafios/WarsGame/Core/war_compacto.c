@@ -0,0 +1,357 @@
+// NÚCLEO DO JOGO DE GUERRA - ARMAZENAMENTO COMPACTO
+//
+// OBJETIVO:
+// Guardar mapas muito grandes em colunas compactas (dono empacotado em bits,
+// tropas em 16 bits, pool de nomes, estado inicial separado) e comparar
+// essa representação com o vetor de Territorio.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "war_core.h"
+
+// ============================================================================
+// FUNÇÃO: criarMapaCompacto
+// DESCRIÇÃO: Converte um mapa comum para o armazenamento compacto
+// PARÂMETROS: compacto (estrutura a preencher)
+//             mapa / quantidade (mapa de origem)
+// RETORNO: 0 em caso de sucesso, 1 em falha de alocação, 2 se alguma
+//          quantidade de tropas não couber em 16 bits ou algum dono for inválido
+// ============================================================================
+int criarMapaCompacto(MapaCompacto *compacto, const Territorio *mapa, int quantidade)
+{
+    memset(compacto, 0, sizeof(MapaCompacto));
+
+    // Descobre quantos bits o maior ID de cor exige
+    int maiorDono = 0;
+    size_t tamanhoNomes = 0;
+    for (int i = 0; i < quantidade; i++)
+    {
+        int dono = mapa[i].dono;
+        int donoInicial = mapa[i].donoInicial;
+        if (dono < 0 || donoInicial < 0 ||
+            mapa[i].tropas < 0 || mapa[i].tropas > MAX_TROPAS_COMPACTO ||
+            mapa[i].tropasInicial < 0 || mapa[i].tropasInicial > MAX_TROPAS_COMPACTO)
+        {
+            return 2;
+        }
+        if (dono > maiorDono)
+        {
+            maiorDono = dono;
+        }
+        tamanhoNomes += strlen(mapa[i].nome) + 1;
+    }
+
+    compacto->bitsDono = 1;
+    while ((1 << compacto->bitsDono) <= maiorDono)
+    {
+        compacto->bitsDono *= 2;
+    }
+
+    int donosPorPalavra = 64 / compacto->bitsDono;
+    compacto->quantidade = quantidade;
+    compacto->tamanhoNomes = tamanhoNomes;
+    compacto->donos = (unsigned long long *)calloc((quantidade + donosPorPalavra - 1) / donosPorPalavra,
+                                                   sizeof(unsigned long long));
+    compacto->tropas = (unsigned short *)malloc(quantidade * sizeof(unsigned short));
+    compacto->inicioNome = (unsigned int *)malloc(quantidade * sizeof(unsigned int));
+    compacto->nomes = (char *)malloc(tamanhoNomes);
+    compacto->donoInicial = (unsigned char *)malloc(quantidade);
+    compacto->tropasInicial = (unsigned short *)malloc(quantidade * sizeof(unsigned short));
+
+    if (compacto->donos == NULL || compacto->tropas == NULL || compacto->inicioNome == NULL ||
+        compacto->nomes == NULL || compacto->donoInicial == NULL || compacto->tropasInicial == NULL)
+    {
+        liberarMapaCompacto(compacto);
+        return 1;
+    }
+
+    size_t posicao = 0;
+    for (int i = 0; i < quantidade; i++)
+    {
+        size_t tamanhoNome = strlen(mapa[i].nome) + 1;
+        memcpy(compacto->nomes + posicao, mapa[i].nome, tamanhoNome);
+        compacto->inicioNome[i] = (unsigned int)posicao;
+        posicao += tamanhoNome;
+
+        definirDonoCompacto(compacto, i, mapa[i].dono);
+        compacto->tropas[i] = (unsigned short)mapa[i].tropas;
+        compacto->donoInicial[i] = (unsigned char)mapa[i].donoInicial;
+        compacto->tropasInicial[i] = (unsigned short)mapa[i].tropasInicial;
+    }
+
+    return 0;
+}
+
+// ============================================================================
+// FUNÇÃO: donoCompacto
+// DESCRIÇÃO: Lê o ID do dono de um território no mapa compacto
+// PARÂMETROS: compacto (mapa), id (território)
+// RETORNO: ID da cor do dono (índice em tabelaCores)
+// ============================================================================
+int donoCompacto(const MapaCompacto *compacto, int id)
+{
+    int donosPorPalavra = 64 / compacto->bitsDono;
+    int deslocamento = (id % donosPorPalavra) * compacto->bitsDono;
+    unsigned long long mascara = (1ULL << compacto->bitsDono) - 1;
+
+    return (int)((compacto->donos[id / donosPorPalavra] >> deslocamento) & mascara);
+}
+
+// ============================================================================
+// FUNÇÃO: definirDonoCompacto
+// DESCRIÇÃO: Grava o ID do dono de um território no mapa compacto
+// PARÂMETROS: compacto (mapa), id (território), dono (ID da cor, deve caber em bitsDono)
+// ============================================================================
+void definirDonoCompacto(MapaCompacto *compacto, int id, int dono)
+{
+    int donosPorPalavra = 64 / compacto->bitsDono;
+    int deslocamento = (id % donosPorPalavra) * compacto->bitsDono;
+    unsigned long long mascara = ((1ULL << compacto->bitsDono) - 1) << deslocamento;
+    unsigned long long *palavra = &compacto->donos[id / donosPorPalavra];
+
+    *palavra = (*palavra & ~mascara) | (((unsigned long long)dono << deslocamento) & mascara);
+}
+
+// ============================================================================
+// FUNÇÃO: alterarTropasCompacto
+// DESCRIÇÃO: Soma (ou subtrai) tropas de um território, recusando resultados
+//            que não caibam no contador de 16 bits
+// PARÂMETROS: compacto (mapa), id (território), variacao (tropas a somar)
+// RETORNO: 0 em caso de sucesso, 1 se o resultado estouraria (nada é alterado)
+// ============================================================================
+int alterarTropasCompacto(MapaCompacto *compacto, int id, int variacao)
+{
+    int novasTropas = (int)compacto->tropas[id] + variacao;
+    if (novasTropas < 0 || novasTropas > MAX_TROPAS_COMPACTO)
+    {
+        return 1;
+    }
+
+    compacto->tropas[id] = (unsigned short)novasTropas;
+    return 0;
+}
+
+// ============================================================================
+// FUNÇÃO: resolverAtaqueCompacto
+// DESCRIÇÃO: Mesmas regras de resolverAtaque(), aplicadas ao mapa compacto
+// PARÂMETROS: compacto (mapa), idAtacante / idDefensor (territórios)
+// RETORNO: ResultadoAtaque com o desfecho e os dados sorteados
+// ============================================================================
+ResultadoAtaque resolverAtaqueCompacto(MapaCompacto *compacto, int idAtacante, int idDefensor)
+{
+    ResultadoAtaque resultado = {ATAQUE_EMPATE, 0, 0, 0};
+    int donoAtacante = donoCompacto(compacto, idAtacante);
+
+    if (donoAtacante == donoCompacto(compacto, idDefensor))
+    {
+        resultado.tipo = ATAQUE_MESMA_COR;
+        return resultado;
+    }
+
+    if (compacto->tropas[idAtacante] == 0)
+    {
+        resultado.tipo = ATAQUE_SEM_TROPAS;
+        return resultado;
+    }
+
+    resultado.dadoAtacante = lancarDado();
+    resultado.dadoDefensor = lancarDado();
+    metricas.ataques++;
+
+    if (resultado.dadoAtacante > resultado.dadoDefensor)
+    {
+        resultado.tipo = ATAQUE_VITORIA;
+        metricas.conquistas++;
+
+        resultado.tropasTransferidas = compacto->tropas[idDefensor] / 2;
+        compacto->tropas[idDefensor] = (unsigned short)resultado.tropasTransferidas;
+        definirDonoCompacto(compacto, idDefensor, donoAtacante);
+    }
+    else if (resultado.dadoAtacante < resultado.dadoDefensor)
+    {
+        resultado.tipo = ATAQUE_DERROTA;
+        compacto->tropas[idAtacante]--;
+    }
+
+    return resultado;
+}
+
+// ============================================================================
+// FUNÇÃO: bytesMapaCompacto
+// DESCRIÇÃO: Calcula a memória ocupada pelo mapa compacto
+// PARÂMETROS: compacto (mapa)
+// RETORNO: total de bytes alocados (colunas quentes, frias e pool de nomes)
+// ============================================================================
+size_t bytesMapaCompacto(const MapaCompacto *compacto)
+{
+    int donosPorPalavra = 64 / compacto->bitsDono;
+    size_t palavras = (compacto->quantidade + donosPorPalavra - 1) / donosPorPalavra;
+
+    return palavras * sizeof(unsigned long long) +
+           compacto->quantidade * (sizeof(unsigned short) + sizeof(unsigned int)) +
+           compacto->tamanhoNomes +
+           compacto->quantidade * (sizeof(unsigned char) + sizeof(unsigned short));
+}
+
+// ============================================================================
+// FUNÇÃO: liberarMapaCompacto
+// DESCRIÇÃO: Libera todas as colunas do mapa compacto
+// PARÂMETROS: compacto (mapa)
+// ============================================================================
+void liberarMapaCompacto(MapaCompacto *compacto)
+{
+    free(compacto->donos);
+    free(compacto->tropas);
+    free(compacto->inicioNome);
+    free(compacto->nomes);
+    free(compacto->donoInicial);
+    free(compacto->tropasInicial);
+    memset(compacto, 0, sizeof(MapaCompacto));
+}
+
+// ============================================================================
+// FUNÇÃO: compararArmazenamento
+// DESCRIÇÃO: Compara o mapa comum e o compacto em memória e velocidade:
+//            bytes por território, uma varredura de tropas, a mesma
+//            sequência de ataques aplicada às duas representações e a
+//            verificação de todas as missões (estados finais e missões
+//            cumpridas precisam coincidir)
+// PARÂMETROS: quantidade (territórios), quantidadeJogadores (cores)
+// RETORNO: 0 em caso de sucesso, 1 em caso de falha
+// ============================================================================
+int compararArmazenamento(int quantidade, int quantidadeJogadores)
+{
+    const int ataques = 10000000;
+    MapaCompacto compacto;
+
+    Territorio *mapa = (Territorio *)calloc(quantidade, sizeof(Territorio));
+    if (mapa == NULL)
+    {
+        printf("❌ Erro: Falha na alocação de memória para territórios!\n");
+        return 1;
+    }
+
+    semearAleatorio(1);
+    gerarMapaAleatorio(mapa, quantidade, quantidadeJogadores);
+    if (criarMapaCompacto(&compacto, mapa, quantidade) != 0)
+    {
+        printf("❌ Erro: Não foi possível criar o mapa compacto!\n");
+        free(mapa);
+        return 1;
+    }
+
+    printf("Territórios: %d | Jogadores: %d | Bits por dono: %d\n\n",
+           quantidade, quantidadeJogadores, compacto.bitsDono);
+    printf("%-28s %14s %14s\n", "", "Comum", "Compacto");
+    printf("%-28s %14.2f %14.2f\n", "Bytes por território",
+           (double)sizeof(Territorio), (double)bytesMapaCompacto(&compacto) / quantidade);
+    printf("%-28s %14.1f %14.1f\n", "Total (MB)",
+           (double)quantidade * sizeof(Territorio) / 1e6, (double)bytesMapaCompacto(&compacto) / 1e6);
+
+    // Varredura: maior quantidade de tropas
+    double inicio = agoraSegundos();
+    int maiorComum = 0;
+    for (int i = 0; i < quantidade; i++)
+    {
+        if (mapa[i].tropas > maiorComum)
+        {
+            maiorComum = mapa[i].tropas;
+        }
+    }
+    double tempoComum = agoraSegundos() - inicio;
+
+    inicio = agoraSegundos();
+    int maiorCompacto = 0;
+    for (int i = 0; i < quantidade; i++)
+    {
+        if (compacto.tropas[i] > maiorCompacto)
+        {
+            maiorCompacto = compacto.tropas[i];
+        }
+    }
+    double tempoCompacto = agoraSegundos() - inicio;
+    printf("%-28s %14.3f %14.3f\n", "Varredura de tropas (ms)", tempoComum * 1e3, tempoCompacto * 1e3);
+
+    // Ataques: a mesma semente gera os mesmos pares e os mesmos dados
+    semearAleatorio(2);
+    inicio = agoraSegundos();
+    for (int i = 0; i < ataques; i++)
+    {
+        int a = (int)(proximoAleatorio() % quantidade);
+        int d = (int)(proximoAleatorio() % quantidade);
+        if (a != d)
+        {
+            resolverAtaque(&mapa[a], &mapa[d]);
+        }
+    }
+    tempoComum = agoraSegundos() - inicio;
+
+    semearAleatorio(2);
+    inicio = agoraSegundos();
+    for (int i = 0; i < ataques; i++)
+    {
+        int a = (int)(proximoAleatorio() % quantidade);
+        int d = (int)(proximoAleatorio() % quantidade);
+        if (a != d)
+        {
+            resolverAtaqueCompacto(&compacto, a, d);
+        }
+    }
+    tempoCompacto = agoraSegundos() - inicio;
+    printf("%-28s %14.1f %14.1f\n", "Ataques (ns por ataque)",
+           tempoComum * 1e9 / ataques, tempoCompacto * 1e9 / ataques);
+
+    // Missões de cada jogador: varredura território a território x varreduras vetorizadas
+    int cumpridaComum[TOTAL_CORES_SIMULACAO][TOTAL_MISSOES];
+    int cumpridaCompacto[TOTAL_CORES_SIMULACAO][TOTAL_MISSOES];
+    int donos[TOTAL_CORES_SIMULACAO];
+    for (int j = 0; j < quantidadeJogadores; j++)
+    {
+        donos[j] = idCor(coresSimulacao[j]);
+    }
+
+    inicio = agoraSegundos();
+    for (int j = 0; j < quantidadeJogadores; j++)
+    {
+        for (int m = 0; m < TOTAL_MISSOES; m++)
+        {
+            cumpridaComum[j][m] = verificarMissao(m, mapa, quantidade, donos[j]);
+        }
+    }
+    tempoComum = agoraSegundos() - inicio;
+
+    inicio = agoraSegundos();
+    for (int j = 0; j < quantidadeJogadores; j++)
+    {
+        for (int m = 0; m < TOTAL_MISSOES; m++)
+        {
+            cumpridaCompacto[j][m] = verificarMissaoCompacto(m, &compacto, donos[j]);
+        }
+    }
+    tempoCompacto = agoraSegundos() - inicio;
+    printf("%-28s %14.3f %14.3f\n", "Todas as missões (ms)", tempoComum * 1e3, tempoCompacto * 1e3);
+
+    int divergencias = (maiorComum != maiorCompacto);
+    for (int j = 0; j < quantidadeJogadores; j++)
+    {
+        for (int m = 0; m < TOTAL_MISSOES; m++)
+        {
+            divergencias += (cumpridaComum[j][m] != cumpridaCompacto[j][m]);
+        }
+    }
+    for (int i = 0; i < quantidade; i++)
+    {
+        if (mapa[i].tropas != compacto.tropas[i] || mapa[i].dono != donoCompacto(&compacto, i))
+        {
+            divergencias++;
+        }
+    }
+    printf("\n%s\n", divergencias == 0 ? "✅ Estados finais idênticos nas duas representações"
+                                        : "❌ As representações divergiram!");
+
+    liberarMapaCompacto(&compacto);
+    free(mapa);
+    return divergencias != 0;
+}
@@ -0,0 +1,797 @@
+// NÚCLEO DO JOGO DE GUERRA - REGRAS, TERRITÓRIOS E MISSÕES
+//
+// OBJETIVO:
+// Implementar uma única vez as funções compartilhadas pelos três níveis:
+// sorteio com semente, cadastro/exibição/seleção de territórios, resolução
+// de ataques e missões.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include "war_core.h"
+
+// Abaixo deste trabalho (missões distintas x territórios) a verificação de
+// vitória fica em uma thread: abrir a região paralela custa mais que o laço
+#define LIMIAR_VENCEDOR_PARALELO 100000
+
+// ============================================================================
+// VETOR DE MISSÕES PRÉ-DEFINIDAS
+// Contém 5 missões estratégicas diferentes para o jogo
+// ============================================================================
+char *missoesPredefinidas[] = {
+    "Conquistar 3 territórios seguidos",
+    "Eliminar todas as tropas da cor vermelha",
+    "Expandir para pelo menos 4 territórios diferentes",
+    "Manter 15 tropas em um único território",
+    "Conquistar o território com maior número inicial de tropas"};
+
+// ============================================================================
+// REGRAS DE CADA NÍVEL
+// O Novato não ataca nem tem missões; o Aventureiro ataca sem missões; o
+// Mestre usa tudo. Os valores de dados e missões são os mesmos nos três.
+// ============================================================================
+const RegrasJogo REGRAS_NOVATO = {"Novato", DADOS_ATAQUE, 15, 3, 4, 0};
+const RegrasJogo REGRAS_AVENTUREIRO = {"Aventureiro", DADOS_ATAQUE, 15, 3, 4, 0};
+const RegrasJogo REGRAS_MESTRE = {"Mestre", DADOS_ATAQUE, 15, 3, 4, 0};
+
+_Thread_local const RegrasJogo *regras = &REGRAS_MESTRE;
+
+// ============================================================================
+// ESTADO DO GERADOR DE NÚMEROS ALEATÓRIOS
+// Gerador próprio (xorshift64*) em vez de rand(), para que uma mesma semente
+// produza a mesma partida em qualquer plataforma ou processo. Cada thread
+// tem o seu estado, o que permite avançar ambientes em paralelo.
+// ============================================================================
+static _Thread_local unsigned long long estadoAleatorio = 88172645463325252ULL;
+
+// ============================================================================
+// MISSÕES POR TAMANHO DE MAPA
+// IDs das missões em ordem crescente de territórios exigidos, calculados uma
+// vez para as regras em uso: as missões compatíveis com um mapa são sempre
+// um prefixo desta ordem. Por thread, para sortear partidas em paralelo.
+// ============================================================================
+static _Thread_local const RegrasJogo *regrasDaOrdemMissoes = NULL;
+static _Thread_local unsigned int versaoDaOrdemMissoes = 0;
+static _Thread_local unsigned char ordemMissoes[TOTAL_MISSOES];
+static _Thread_local int minimoOrdemMissoes[TOTAL_MISSOES];
+
+// ============================================================================
+// FUNÇÃO: usarRegras
+// DESCRIÇÃO: Escolhe as regras usadas pelas funções do núcleo nesta thread
+//            (cada partida retoma as suas antes de jogar um turno)
+// PARÂMETROS: novasRegras (ex.: &REGRAS_AVENTUREIRO, ou de fixarRegras)
+// ============================================================================
+void usarRegras(const RegrasJogo *novasRegras)
+{
+    regras = novasRegras;
+}
+
+// ============================================================================
+// FUNÇÃO: semearAleatorio
+// DESCRIÇÃO: Inicializa o gerador de números aleatórios a partir de uma semente
+//            (espalhada com splitmix64 para que sementes vizinhas gerem
+//            sequências independentes)
+// PARÂMETROS: semente (valor inicial, ex.: time(NULL) ou número da partida)
+// ============================================================================
+void semearAleatorio(unsigned long long semente)
+{
+    unsigned long long z = semente + 0x9E3779B97F4A7C15ULL;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    z = z ^ (z >> 31);
+
+    // O xorshift nunca pode partir do estado zero
+    estadoAleatorio = (z != 0) ? z : 88172645463325252ULL;
+}
+
+// ============================================================================
+// FUNÇÃO: proximoAleatorio
+// DESCRIÇÃO: Gera o próximo número pseudoaleatório (xorshift64*)
+// RETORNO: número aleatório de 32 bits
+// ============================================================================
+unsigned int proximoAleatorio()
+{
+    return proximoAleatorioDe(&estadoAleatorio);
+}
+
+// ============================================================================
+// FUNÇÃO: proximoAleatorioDe
+// DESCRIÇÃO: Mesmo gerador, avançando um estado guardado pelo chamador
+//            (ex.: um gerador próprio de cada partida)
+// PARÂMETROS: estado (estado do gerador; nunca zero)
+// RETORNO: número aleatório de 32 bits
+// ============================================================================
+unsigned int proximoAleatorioDe(unsigned long long *estado)
+{
+    *estado ^= *estado >> 12;
+    *estado ^= *estado << 25;
+    *estado ^= *estado >> 27;
+    return (unsigned int)((*estado * 0x2545F4914F6CDD1DULL) >> 32);
+}
+
+// ============================================================================
+// FUNÇÃO: salvarAleatorio / restaurarAleatorio
+// DESCRIÇÃO: Leem e repõem o estado do gerador, para que várias partidas
+//            intercaladas mantenham cada uma a sua própria sequência
+// ============================================================================
+unsigned long long salvarAleatorio()
+{
+    return estadoAleatorio;
+}
+
+void restaurarAleatorio(unsigned long long estado)
+{
+    estadoAleatorio = estado;
+}
+
+// ============================================================================
+// FUNÇÃO: lancarDado
+// DESCRIÇÃO: Simula o lançamento de um dado (6 faces nas regras padrão)
+// RETORNO: número aleatório entre 1 e regras->facesDado
+// ============================================================================
+int lancarDado()
+{
+    return (int)(proximoAleatorio() % regras->facesDado) + 1;
+}
+
+// ============================================================================
+// FUNÇÃO: territoriosMinimosMissao
+// DESCRIÇÃO: Quantos territórios o mapa precisa ter para a missão ser possível
+// PARÂMETROS: missao (ID em missoesPredefinidas)
+// RETORNO: mínimo de territórios (0 se a missão serve para qualquer mapa)
+// ============================================================================
+static int territoriosMinimosMissao(int missao)
+{
+    switch (missao)
+    {
+    case MISSAO_SEQUENCIA:
+        return regras->territoriosSeguidos;
+    case MISSAO_EXPANSAO:
+        return regras->territoriosExpansao;
+    default:
+        return 0;
+    }
+}
+
+// ============================================================================
+// FUNÇÃO: iniciarSorteioMissoes
+// DESCRIÇÃO: Enche a urna com as missões compatíveis com o tamanho do mapa.
+//            Se nenhuma for compatível (caso extremo), usa todas.
+// PARÂMETROS: sorteio (urna a preencher), tamanhoMapa (territórios do mapa)
+// ============================================================================
+void iniciarSorteioMissoes(SorteioMissoes *sorteio, int tamanhoMapa)
+{
+    // Ordena as missões pelo mínimo de territórios (só quando as regras mudam)
+    // (a versão também entra na comparação: uma versão liberada pode dar o
+    // endereço para a seguinte)
+    if (regrasDaOrdemMissoes != regras || versaoDaOrdemMissoes != regras->versao)
+    {
+        for (int m = 0; m < TOTAL_MISSOES; m++)
+        {
+            int minimo = territoriosMinimosMissao(m);
+            int posicao = m;
+            for (; posicao > 0 && minimoOrdemMissoes[posicao - 1] > minimo; posicao--)
+            {
+                ordemMissoes[posicao] = ordemMissoes[posicao - 1];
+                minimoOrdemMissoes[posicao] = minimoOrdemMissoes[posicao - 1];
+            }
+            ordemMissoes[posicao] = (unsigned char)m;
+            minimoOrdemMissoes[posicao] = minimo;
+        }
+        regrasDaOrdemMissoes = regras;
+        versaoDaOrdemMissoes = regras->versao;
+    }
+
+    int compativeis = 0;
+    while (compativeis < TOTAL_MISSOES && minimoOrdemMissoes[compativeis] <= tamanhoMapa)
+    {
+        compativeis++;
+    }
+
+    sorteio->quantidadeCompativeis = (compativeis > 0) ? compativeis : TOTAL_MISSOES;
+    memcpy(sorteio->compativeis, ordemMissoes, sizeof(sorteio->compativeis));
+    sorteio->quantidadeRestantes = 0;
+}
+
+// ============================================================================
+// FUNÇÃO: missaoCabivel
+// DESCRIÇÃO: Confere se a missão ainda tem o que ser feito pelo jogador no
+//            mapa da preparação: uma missão já cumprida terminaria a
+//            partida no primeiro turno, e uma impossível nunca a terminaria
+// PARÂMETROS: missao (ID em missoesPredefinidas), mapa / tamanho (mapa da
+//             preparação), donoJogador (ID da cor do jogador)
+// RETORNO: 1 se a missão pode ser entregue ao jogador, 0 caso contrário
+// ============================================================================
+static int missaoCabivel(int missao, Territorio *mapa, int tamanho, int donoJogador)
+{
+    if (verificarMissao(missao, mapa, tamanho, donoJogador))
+    {
+        return 0;
+    }
+
+    switch (missao)
+    {
+    case MISSAO_VERMELHA: // A cor vermelha não elimina as próprias tropas
+        return donoJogador != idVermelho;
+    case MISSAO_TROPAS: // As tropas nunca aumentam: só uma conquista (metade do defensor) chega lá
+        for (int i = 0; i < tamanho; i++)
+        {
+            if (mapa[i].dono != donoJogador && mapa[i].tropas / 2 >= regras->tropasMissao)
+            {
+                return 1;
+            }
+        }
+        return 0;
+    default:
+        return tamanho > 0;
+    }
+}
+
+// ============================================================================
+// FUNÇÃO: sortearMissao
+// DESCRIÇÃO: Tira uma missão da urna, sem reposição, entre as que cabem ao
+//            jogador no mapa da preparação (nem já cumpridas nem
+//            impossíveis). A urna só é reabastecida quando esvazia; se
+//            nenhuma das restantes cabe, o jogador fica sem missão em vez
+//            de repetir a de outro jogador.
+// PARÂMETROS: sorteio (urna preenchida por iniciarSorteioMissoes)
+//             estado (gerador próprio da partida, ou NULL para o da thread)
+//             mapa / tamanho (mapa da preparação)
+//             donoJogador (ID da cor do jogador)
+// RETORNO: ID da missão sorteada (índice em missoesPredefinidas), ou
+//          SEM_MISSAO se nenhuma missão cabe ao jogador
+// ============================================================================
+int sortearMissao(SorteioMissoes *sorteio, unsigned long long *estado, Territorio *mapa, int tamanho,
+                  int donoJogador)
+{
+    if (sorteio->quantidadeRestantes == 0)
+    {
+        memcpy(sorteio->restantes, sorteio->compativeis, sizeof(sorteio->restantes));
+        sorteio->quantidadeRestantes = sorteio->quantidadeCompativeis;
+    }
+
+    // Posições da urna com missões que cabem ao jogador
+    int cabiveis[TOTAL_MISSOES];
+    int quantidadeCabiveis = 0;
+    for (int posicao = 0; posicao < sorteio->quantidadeRestantes; posicao++)
+    {
+        if (missaoCabivel(sorteio->restantes[posicao], mapa, tamanho, donoJogador))
+        {
+            cabiveis[quantidadeCabiveis++] = posicao;
+        }
+    }
+    if (quantidadeCabiveis == 0)
+    {
+        return SEM_MISSAO;
+    }
+
+    unsigned int numero = (estado != NULL) ? proximoAleatorioDe(estado) : proximoAleatorio();
+    int posicao = cabiveis[numero % (unsigned int)quantidadeCabiveis];
+    int missao = sorteio->restantes[posicao];
+
+    // A última da urna ocupa o lugar da sorteada
+    sorteio->restantes[posicao] = sorteio->restantes[--sorteio->quantidadeRestantes];
+    return missao;
+}
+
+// ============================================================================
+// FUNÇÃO: sortearMissoesJogadores
+// DESCRIÇÃO: Sorteia a missão de cada jogador com sortearMissao()
+// PARÂMETROS: sorteio, estado (como em sortearMissao), mapa / tamanho
+//             donos (cor de cada jogador), missoes (saída: IDs, SEM_MISSAO
+//             para o jogador sem missão possível), quantidadeJogadores
+// ============================================================================
+void sortearMissoesJogadores(SorteioMissoes *sorteio, unsigned long long *estado, Territorio *mapa, int tamanho,
+                             const int *donos, int *missoes, int quantidadeJogadores)
+{
+    for (int i = 0; i < quantidadeJogadores; i++)
+    {
+        missoes[i] = sortearMissao(sorteio, estado, mapa, tamanho, donos[i]);
+    }
+}
+
+// ============================================================================
+// FUNÇÃO: coresDosJogadores
+// DESCRIÇÃO: Cor comandada por cada jogador de um mapa cadastrado: o jogador
+//            i fica com a i-ésima cor distinta, na ordem em que aparecem no
+//            mapa (a mesma de gerarMapaAleatorio)
+// PARÂMETROS: mapa / tamanho, donos (saída), quantidadeJogadores
+// RETORNO: quantidade de jogadores com cor (os demais recebem -1)
+// ============================================================================
+int coresDosJogadores(const Territorio *mapa, int tamanho, int *donos, int quantidadeJogadores)
+{
+    int encontradas = 0;
+    for (int i = 0; i < tamanho && encontradas < quantidadeJogadores; i++)
+    {
+        int repetida = 0;
+        for (int k = 0; k < encontradas && !repetida; k++)
+        {
+            repetida = donos[k] == mapa[i].dono;
+        }
+        if (!repetida)
+        {
+            donos[encontradas++] = mapa[i].dono;
+        }
+    }
+    for (int k = encontradas; k < quantidadeJogadores; k++)
+    {
+        donos[k] = -1;
+    }
+    return encontradas;
+}
+
+// ============================================================================
+// FUNÇÃO: exibirMissao
+// DESCRIÇÃO: Exibe a missão atribuída ao jogador
+// PARÂMETROS: missao (ID em missoesPredefinidas, ou SEM_MISSAO)
+//             nomeJogador (identificador do jogador)
+// ============================================================================
+void exibirMissao(int missao, const char *nomeJogador)
+{
+    printf("\n");
+    printf("╔════════════════════════════════════════════════╗\n");
+    printf("║           MISSÃO ESTRATÉGICA DESIGNADA         ║\n");
+    printf("╚════════════════════════════════════════════════╝\n");
+    printf("🎯 Jogador: %s\n", nomeJogador);
+    char texto[MAX_MISSAO];
+    descreverMissao(missao, texto, sizeof(texto));
+    printf("📋 Missão: %s\n\n", texto);
+}
+
+// ============================================================================
+// FUNÇÃO: descreverMissao
+// DESCRIÇÃO: Texto da missão com os números das regras em uso (o texto de
+//            missoesPredefinidas traz os números das regras embutidas)
+// PARÂMETROS: missao (ID em missoesPredefinidas, ou SEM_MISSAO)
+//             texto / tamanho (saída)
+// ============================================================================
+void descreverMissao(int missao, char *texto, size_t tamanho)
+{
+    switch (missao)
+    {
+    case MISSAO_SEQUENCIA:
+        snprintf(texto, tamanho, "Conquistar %d territórios seguidos", regras->territoriosSeguidos);
+        break;
+    case MISSAO_EXPANSAO:
+        snprintf(texto, tamanho, "Expandir para pelo menos %d territórios diferentes", regras->territoriosExpansao);
+        break;
+    case MISSAO_TROPAS:
+        snprintf(texto, tamanho, "Manter %d tropas em um único território", regras->tropasMissao);
+        break;
+    case MISSAO_VERMELHA:
+    case MISSAO_MAIOR_INICIAL:
+        snprintf(texto, tamanho, "%s", missoesPredefinidas[missao]);
+        break;
+    default:
+        snprintf(texto, tamanho, "Sem missão");
+        break;
+    }
+}
+
+// ============================================================================
+// FUNÇÃO: verificarMissao
+// DESCRIÇÃO: Verifica se a missão do jogador foi cumprida analisando
+//            o estado atual do mapa de territórios
+// PARÂMETROS: missao (ID em missoesPredefinidas, ou SEM_MISSAO)
+//             mapa (ponteiro para array de territórios)
+//             tamanho (quantidade total de territórios)
+//             donoJogador (ID da cor comandada pelo jogador)
+// RETORNO: 1 se a missão foi cumprida, 0 caso contrário
+// ============================================================================
+int verificarMissao(int missao, const Territorio *mapa, int tamanho, int donoJogador)
+{
+    switch (missao)
+    {
+    case MISSAO_SEQUENCIA:
+    {
+        // Procura por territórios consecutivos da cor do jogador
+        int sequencia = 0;
+        for (int i = 0; i < tamanho; i++)
+        {
+            sequencia = (mapa[i].dono == donoJogador) ? sequencia + 1 : 0;
+            if (sequencia >= regras->territoriosSeguidos)
+            {
+                return 1;
+            }
+        }
+        return 0;
+    }
+
+    case MISSAO_VERMELHA:
+        // Qualquer grafia de vermelho tem o mesmo ID (idVermelho)
+        for (int i = 0; i < tamanho && idVermelho >= 0; i++)
+        {
+            if (mapa[i].dono == idVermelho)
+            {
+                return 0; // Ainda há territórios vermelhos
+            }
+        }
+        return 1;
+
+    case MISSAO_EXPANSAO:
+    {
+        // Conta territórios da cor do jogador
+        int territoriosControlados = 0;
+        for (int i = 0; i < tamanho; i++)
+        {
+            if (mapa[i].dono == donoJogador)
+            {
+                territoriosControlados++;
+            }
+        }
+        return territoriosControlados >= regras->territoriosExpansao;
+    }
+
+    case MISSAO_TROPAS:
+        for (int i = 0; i < tamanho; i++)
+        {
+            if (mapa[i].dono == donoJogador && mapa[i].tropas >= regras->tropasMissao)
+            {
+                return 1;
+            }
+        }
+        return 0;
+
+    case MISSAO_MAIOR_INICIAL:
+    {
+        // Encontra o território com mais tropas no cadastro (o primeiro, no empate)
+        int maxTropas = (tamanho > 0) ? mapa[0].tropasInicial : 0;
+        for (int i = 0; i < tamanho; i++)
+        {
+            maxTropas = (mapa[i].tropasInicial > maxTropas) ? mapa[i].tropasInicial : maxTropas;
+        }
+        int maior = 0;
+        while (maior < tamanho && mapa[maior].tropasInicial < maxTropas)
+        {
+            maior++;
+        }
+
+        // Cumprida quando a cor do jogador controla esse território
+        return maior < tamanho && mapa[maior].dono == donoJogador;
+    }
+
+    default:
+        return 0;
+    }
+}
+
+// ============================================================================
+// FUNÇÃO: cadastrarTerritorios
+// DESCRIÇÃO: Solicita ao usuário informações dos territórios. A cor é
+//            registrada (idCor) e o território guarda apenas o seu ID.
+// PARÂMETROS: ponteiro para array de Territorio, quantidade de territórios
+// ============================================================================
+void cadastrarTerritorios(Territorio *territorios, int quantidade)
+{
+    printf("\n");
+    printf("╔════════════════════════════════════════════════╗\n");
+    printf("║    CADASTRO DE TERRITÓRIOS - %d REGIÕES       ║\n", quantidade);
+    printf("╚════════════════════════════════════════════════╝\n\n");
+
+    for (int i = 0; i < quantidade; i++)
+    {
+        printf("--- Território %d de %d ---\n", i + 1, quantidade);
+
+        printf("Digite o nome do território: ");
+        fgets(territorios[i].nome, MAX_NOME, stdin);
+        territorios[i].nome[strcspn(territorios[i].nome, "\n")] = '\0';
+
+        char cor[MAX_COR];
+        do
+        {
+            printf("Digite a cor do exército: ");
+            fgets(cor, MAX_COR, stdin);
+            cor[strcspn(cor, "\n")] = '\0';
+
+            territorios[i].dono = idCor(cor);
+            if (territorios[i].dono < 0)
+            {
+                printf("❌ Cores demais! Use uma das cores já cadastradas.\n");
+            }
+        } while (territorios[i].dono < 0);
+
+        // Salva a cor inicial
+        territorios[i].donoInicial = territorios[i].dono;
+
+        // Tropas negativas não existem no jogo (e o fluxo de deltas grava
+        // as tropas da fotografia sem sinal)
+        do
+        {
+            printf("Digite a quantidade de tropas: ");
+            scanf("%d", &territorios[i].tropas);
+            getchar();
+
+            if (territorios[i].tropas < 0)
+            {
+                printf("❌ Quantidade inválida! As tropas não podem ser negativas.\n");
+            }
+        } while (territorios[i].tropas < 0);
+
+        // Salva as tropas iniciais
+        territorios[i].tropasInicial = territorios[i].tropas;
+
+        printf("\n");
+    }
+}
+
+// ============================================================================
+// FUNÇÃO: exibirTerritorios
+// DESCRIÇÃO: Exibe as informações de todos os territórios cadastrados
+// PARÂMETROS: ponteiro para array de Territorio, quantidade de territórios
+// ============================================================================
+void exibirTerritorios(Territorio *territorios, int quantidade)
+{
+    printf("\n");
+    printf("╔════════════════════════════════════════════════╗\n");
+    printf("║        TERRITÓRIOS CADASTRADOS - RESUMO        ║\n");
+    printf("╚════════════════════════════════════════════════╝\n\n");
+
+    for (int i = 0; i < quantidade; i++)
+    {
+        printf("┌────────────────────────────────────────────┐\n");
+        printf("│ Território %d [ID: %d]                      │\n", i + 1, i);
+        printf("├────────────────────────────────────────────┤\n");
+        printf("│ Nome:  %-35s │\n", territorios[i].nome);
+        printf("│ Cor:   %-35s │\n", tabelaCores[territorios[i].dono]);
+        printf("│ Tropas: %-34d │\n", territorios[i].tropas);
+        printf("└────────────────────────────────────────────┘\n\n");
+    }
+}
+
+// ============================================================================
+// FUNÇÃO: selecionarTerritorio
+// DESCRIÇÃO: Solicita ao usuário a seleção de um território com validação
+// PARÂMETROS: quantidade de territórios disponíveis, mensagem de seleção
+// RETORNO: índice do território selecionado
+// ============================================================================
+int selecionarTerritorio(int quantidade, const char *mensagem)
+{
+    int territorio;
+
+    while (1)
+    {
+        printf("%s", mensagem);
+        scanf("%d", &territorio);
+        getchar();
+
+        // Validação de entrada
+        if (territorio < 0 || territorio >= quantidade)
+        {
+            printf("❌ Seleção inválida! Digite um ID entre 0 e %d.\n\n", quantidade - 1);
+        }
+        else
+        {
+            return territorio;
+        }
+    }
+}
+
+// ============================================================================
+// FUNÇÃO: resolverAtaque
+// DESCRIÇÃO: Aplica as regras de um ataque entre dois territórios sem
+//            imprimir nada: valida, lança os dados e atualiza os territórios
+// PARÂMETROS: ponteiros para territórios atacante e defensor (passagem por referência)
+// RETORNO: ResultadoAtaque com o desfecho e os dados sorteados
+// ============================================================================
+ResultadoAtaque resolverAtaque(Territorio *atacante, Territorio *defensor)
+{
+    ResultadoAtaque resultado = {ATAQUE_EMPATE, 0, 0, 0};
+
+    // Validação: não atacar próprio território
+    if (atacante->dono == defensor->dono)
+    {
+        resultado.tipo = ATAQUE_MESMA_COR;
+        return resultado;
+    }
+
+    // Verificar se atacante tem tropas
+    if (atacante->tropas <= 0)
+    {
+        resultado.tipo = ATAQUE_SEM_TROPAS;
+        return resultado;
+    }
+
+    // Lançar dados
+    resultado.dadoAtacante = lancarDado();
+    resultado.dadoDefensor = lancarDado();
+    metricas.ataques++;
+    if (estatisticasBatalhas != NULL)
+    {
+        registrarBatalha(estatisticasBatalhas, atacante, defensor,
+                         resultado.dadoAtacante, resultado.dadoDefensor);
+    }
+
+    // Determinar resultado do ataque
+    if (resultado.dadoAtacante > resultado.dadoDefensor)
+    {
+        resultado.tipo = ATAQUE_VITORIA;
+        metricas.conquistas++;
+
+        // Calcula tropas transferidas (metade das tropas do defensor)
+        resultado.tropasTransferidas = defensor->tropas / 2;
+        defensor->tropas = resultado.tropasTransferidas;
+
+        // Transfere a cor para o defensor
+        defensor->dono = atacante->dono;
+    }
+    else if (resultado.dadoAtacante < resultado.dadoDefensor)
+    {
+        resultado.tipo = ATAQUE_DERROTA;
+
+        // Atacante perde uma tropa
+        atacante->tropas--;
+    }
+
+    return resultado;
+}
+
+// ============================================================================
+// FUNÇÃO: atacar
+// DESCRIÇÃO: Simula um ataque entre dois territórios e exibe o resultado
+// PARÂMETROS: ponteiros para territórios atacante e defensor (passagem por referência)
+// NOTA: A lógica fica em resolverAtaque(); aqui só se apresenta o desfecho
+// ============================================================================
+void atacar(Territorio *atacante, Territorio *defensor)
+{
+    printf("\n");
+    printf("╔════════════════════════════════════════════════╗\n");
+    printf("║            SIMULAÇÃO DE ATAQUE                 ║\n");
+    printf("╚════════════════════════════════════════════════╝\n\n");
+
+    // Guarda o estado anterior para exibir quem atacou quem
+    const char *corAtacante = tabelaCores[atacante->dono];
+    const char *corDefensor = tabelaCores[defensor->dono];
+    int tropasAtacante = atacante->tropas;
+    int tropasDefensor = defensor->tropas;
+
+    ResultadoAtaque resultado = resolverAtaque(atacante, defensor);
+
+    if (resultado.tipo == ATAQUE_MESMA_COR)
+    {
+        printf("❌ ERRO: Você não pode atacar um território de sua própria cor!\n\n");
+        return;
+    }
+
+    if (resultado.tipo == ATAQUE_SEM_TROPAS)
+    {
+        printf("❌ ERRO: O território atacante não tem tropas!\n\n");
+        return;
+    }
+
+    printf("🎲 %s [%s] (%d tropas) atacando %s [%s] (%d tropas)...\n\n",
+           atacante->nome, corAtacante, tropasAtacante,
+           defensor->nome, corDefensor, tropasDefensor);
+
+    printf("🎲 Dados de ataque:\n");
+    printf("   • %s [%s] lançou: %d\n", atacante->nome, corAtacante, resultado.dadoAtacante);
+    printf("   • %s [%s] lançou: %d\n\n", defensor->nome, corDefensor, resultado.dadoDefensor);
+
+    if (resultado.tipo == ATAQUE_VITORIA)
+    {
+        printf("✅ VITÓRIA! %s conquistou %s!\n\n", atacante->nome, defensor->nome);
+
+        printf("📊 Resultado:\n");
+        printf("   • %s agora controla %s!\n", corAtacante, defensor->nome);
+        printf("   • Tropas transferidas: %d\n", resultado.tropasTransferidas);
+        printf("   • Novas tropas em %s: %d\n\n", defensor->nome, defensor->tropas);
+    }
+    else if (resultado.tipo == ATAQUE_DERROTA)
+    {
+        printf("❌ DERROTA! %s repeliu o ataque de %s!\n\n",
+               defensor->nome, atacante->nome);
+
+        printf("📊 Resultado:\n");
+        printf("   • %s perdeu 1 tropa na batalha.\n", atacante->nome);
+        printf("   • Tropas restantes em %s: %d\n\n", atacante->nome, atacante->tropas);
+    }
+    else
+    {
+        printf("🤝 EMPATE! Nenhum território muda de controle.\n");
+        printf("   • %s mantém %s\n\n", corDefensor, defensor->nome);
+    }
+}
+
+// ============================================================================
+// FUNÇÃO: verificarVencedor
+// DESCRIÇÃO: Verifica se algum jogador completou sua missão ao final do turno
+// PARÂMETROS: IDs das missões dos jogadores (SEM_MISSAO para quem não tem)
+//             donos (cor comandada por cada jogador)
+//             ponteiro para array de territórios
+//             quantidade de jogadores
+//             quantidade de territórios
+// RETORNO: índice do jogador vencedor (-1 se nenhum venceu ainda)
+// Jogadores com a mesma missão e a mesma cor (ou com a missão vermelha, que
+// não depende da cor) têm o mesmo resultado, então cada par é verificado uma
+// vez e vence o de menor índice. Com OpenMP, em mapas grandes os pares
+// distintos são verificados em paralelo e o vencedor continua sendo o menor
+// índice.
+// ============================================================================
+int verificarVencedor(const int *missoes, const int *donos, Territorio *mapa, int quantidadeJogadores,
+                      int quantidadeTerritorios)
+{
+    // Mais jogadores que as cores da simulação (partida interativa): laço simples
+    if (quantidadeJogadores > TOTAL_CORES_SIMULACAO)
+    {
+        for (int i = 0; i < quantidadeJogadores; i++)
+        {
+            if (verificarMissao(missoes[i], mapa, quantidadeTerritorios, donos[i]))
+            {
+                return i;
+            }
+        }
+        return -1;
+    }
+
+    // Primeiro jogador de cada par (missão, cor) distinto, em ordem crescente
+    int jogadores[TOTAL_CORES_SIMULACAO];
+    int distintas = 0;
+    for (int i = 0; i < quantidadeJogadores; i++)
+    {
+        int repetida = missoes[i] == SEM_MISSAO;
+        for (int k = 0; k < distintas && !repetida; k++)
+        {
+            repetida = missoes[jogadores[k]] == missoes[i] &&
+                       (donos[jogadores[k]] == donos[i] || missoes[i] == MISSAO_VERMELHA);
+        }
+        if (!repetida)
+        {
+            jogadores[distintas++] = i;
+        }
+    }
+
+#ifdef _OPENMP
+    int threads = omp_get_max_threads();
+    if (distintas > 1 && threads > 1 && !omp_in_parallel() &&
+        (long long)distintas * quantidadeTerritorios >= LIMIAR_VENCEDOR_PARALELO)
+    {
+        // Cada missão é uma tarefa; uma missão cumprida descarta as de
+        // jogadores com índice maior, que não poderiam vencer. As regras são
+        // por thread: cada tarefa usa as da partida e devolve as da thread
+        int menor = distintas;
+        const RegrasJogo *regrasDaPartida = regras;
+#pragma omp parallel for schedule(dynamic, 1) num_threads(threads < distintas ? threads : distintas)
+        for (int k = 0; k < distintas; k++)
+        {
+            int atual;
+            const RegrasJogo *regrasDaThread = regras;
+            regras = regrasDaPartida;
+#pragma omp atomic read
+            atual = menor;
+            if (k < atual &&
+                verificarMissao(missoes[jogadores[k]], mapa, quantidadeTerritorios, donos[jogadores[k]]))
+            {
+                // A seção crítica serializa as escritas; a leitura e a
+                // escrita continuam atômicas porque as outras tarefas leem
+                // "menor" fora dela
+#pragma omp critical(vencedorParalelo)
+                {
+                    int vigente;
+#pragma omp atomic read
+                    vigente = menor;
+                    if (k < vigente)
+                    {
+#pragma omp atomic write
+                        menor = k;
+                    }
+                }
+            }
+            regras = regrasDaThread;
+        }
+        return (menor < distintas) ? jogadores[menor] : -1;
+    }
+#endif
+
+    for (int k = 0; k < distintas; k++)
+    {
+        if (verificarMissao(missoes[jogadores[k]], mapa, quantidadeTerritorios, donos[jogadores[k]]))
+        {
+            return jogadores[k];
+        }
+    }
+    return -1;
+}
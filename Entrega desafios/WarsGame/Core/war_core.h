@@ -0,0 +1,864 @@
+// NÚCLEO DO JOGO DE GUERRA - WAR GAME CORE
+//
+// OBJETIVO:
+// Reunir em uma única biblioteca (libwarcore) tudo o que os níveis Novato,
+// Aventureiro e Mestre têm em comum:
+// - Estrutura Territorio, cadastro, exibição e seleção de territórios
+// - Gerador de números aleatórios com semente e lançamento de dados
+// - Resolução de ataques e verificação de missões
+// - Regras configuráveis por nível (RegrasJogo)
+// - Ferramentas do Mestre: simulação em lote, deltas binários, métricas,
+//   armazenamento compacto e verificação de regras
+// Cada nível mantém apenas o seu main() e o seu menu.
+
+#ifndef WAR_CORE_H
+#define WAR_CORE_H
+
+#include <stdio.h>
+#include <stddef.h>
+
+// ============================================================================
+// CONSTANTES
+// ============================================================================
+#define MAX_NOME 30
+#define MAX_COR 10
+#define MAX_MISSAO 100
+#define TOTAL_MISSOES 5 // Missões em missoesPredefinidas (IDs em IdMissao)
+#define DADOS_ATAQUE 6 // Simulação de dados (1 a 6)
+#define MAX_TURNOS_SIMULACAO 10000 // Limite de turnos de uma partida simulada
+#define MAX_CORES 64               // Cores distintas que recebem um ID de dono
+#define VERSAO_FLUXO 1             // Versão do formato binário de deltas
+#define TOTAL_FAIXAS_LATENCIA 8    // Faixas do histograma de duração do turno
+#define MAX_TROPAS_COMPACTO 65535  // Limite das tropas no armazenamento compacto (16 bits)
+#define TERRITORIOS_VERIFICACAO 8  // Tamanho do mapa usado na verificação de regras
+#define INTERVALO_DESFAZER 64      // Ações entre dois "desfazer e refazer tudo" na verificação
+#define TOTAL_CORES_SIMULACAO 6    // Cores em coresSimulacao
+#define TOTAL_CORES_VERIFICACAO 8  // Cores em coresVerificacao
+#define TOTAL_PROPRIEDADES 7       // Propriedades em propriedadesRegras
+#define TENTATIVAS_JOGADA 8        // Sorteios de território antes de um agente passar a vez
+#define MAX_MENSAGEM_LOCKSTEP 20   // Maior mensagem de um turno no lockstep (bytes)
+#define TERRITORIOS_POR_BLOCO 32   // Territórios em cada bloco compartilhado de MapaRamificado
+#define VALORES_OBSERVACAO 2       // Valores por território na observação (dono, tropas)
+#define ACAO_PASSAR (-1)           // Ação do agente que não ataca
+#define MAX_FACES_ESTATISTICA 20   // Faces de dado contadas nas estatísticas de batalha
+#define BITS_DISPUTADOS 16         // 2^16 contadores do SpaceSaving dos territórios mais disputados
+#define TOTAL_DISPUTADOS (1 << BITS_DISPUTADOS)
+#define DISPUTADOS_EXIBIDOS 10     // Territórios mais disputados exibidos e exportados
+#define FNV_BASE 14695981039346656037ULL // Valor inicial do hash FNV-1a de 64 bits
+#define FNV_PRIMO 1099511628211ULL       // Multiplicador do FNV-1a
+#define BITS_SUBFAIXA 5            // HistogramaLog: 2^5 subfaixas por potência de 2 (erro < 3,2%)
+#define TOTAL_FAIXAS_LOG ((64 - BITS_SUBFAIXA) * (1 << BITS_SUBFAIXA) + (1 << BITS_SUBFAIXA))
+#define VERSAO_CENARIO 2           // Versão do formato dos pacotes de cenário
+#define ALINHAMENTO_CENARIO 64     // Alinhamento (bytes) de cada seção do pacote de cenário
+#define ALINHAMENTO_ARENA 16       // Alinhamento (bytes) de cada bloco entregue pela ArenaPartida
+#define MAX_SUGESTOES_ATAQUE 16    // Ataques devolvidos no máximo por analisarAtaques
+
+// ============================================================================
+// ESTRUTURA: Territorio
+// Armazena informações sobre um território no jogo de guerra. A cor do
+// exército é guardada pelo seu ID no registro de cores (idCor); o nome fica
+// em tabelaCores[dono].
+// ============================================================================
+typedef struct
+{
+    char nome[MAX_NOME]; // Nome do território
+    int dono;            // ID da cor do exército que controla o território
+    int tropas;          // Quantidade de tropas no território
+    int donoInicial;     // ID da cor no cadastro
+    int tropasInicial;   // Tropas iniciais no cadastro
+} Territorio;
+
+// ============================================================================
+// ESTRUTURA: RegrasJogo
+// Parâmetros das regras que variam conforme o nível. Cada programa escolhe
+// as suas com usarRegras() antes de começar o jogo. Uma vez em uso, regras
+// nunca mudam: recarregar o arquivo de regras publica uma versão nova
+// (ver VersaoRegras) e as partidas em andamento continuam na delas.
+// ============================================================================
+typedef struct
+{
+    const char *nivel;       // Nome do nível
+    int facesDado;           // Faces dos dados de ataque e defesa
+    int tropasMissao;        // Missão "Manter N tropas em um único território"
+    int territoriosSeguidos; // Missão "Conquistar N territórios seguidos"
+    int territoriosExpansao; // Missão "Expandir para pelo menos N territórios diferentes"
+    unsigned int versao;     // 0 nas regras embutidas; cada recarga publica a seguinte
+} RegrasJogo;
+
+// ============================================================================
+// ESTRUTURA: VersaoRegras
+// Regras lidas de um arquivo (war_regras.c). A versão publicada é trocada
+// de uma vez por recarregarRegras(); quem começa uma partida fixa a versão
+// do momento (fixarRegras) e a solta ao terminar (soltarRegras). Uma versão
+// substituída é liberada quando a última partida fixada nela termina.
+// ============================================================================
+typedef struct
+{
+    RegrasJogo regras;      // Primeiro campo: &versao->regras aponta para a versão
+    char nivel[MAX_NOME];   // Texto apontado por regras.nivel
+    int fixacoes;           // Partidas fixadas + 1 enquanto for a publicada
+} VersaoRegras;
+
+// ============================================================================
+// ENUM: IdMissao
+// ID de cada missão: a posição do texto em missoesPredefinidas. Partidas,
+// ambientes e cenários guardam só o ID; o texto serve para exibição.
+// ============================================================================
+typedef enum
+{
+    SEM_MISSAO = -1,      // Jogador sem missão possível no mapa
+    MISSAO_SEQUENCIA,     // Conquistar 3 territórios seguidos
+    MISSAO_VERMELHA,      // Eliminar todas as tropas da cor vermelha
+    MISSAO_EXPANSAO,      // Expandir para pelo menos 4 territórios diferentes
+    MISSAO_TROPAS,        // Manter 15 tropas em um único território
+    MISSAO_MAIOR_INICIAL  // Conquistar o território com maior número inicial de tropas
+} IdMissao;
+
+// ============================================================================
+// ENUM: TipoResultado / ESTRUTURA: ResultadoAtaque
+// Descreve o desfecho de um ataque sem depender da saída na tela, para que a
+// mesma lógica sirva ao jogo interativo e às simulações em lote
+// ============================================================================
+typedef enum
+{
+    ATAQUE_MESMA_COR,    // Ataque inválido: territórios da mesma cor
+    ATAQUE_SEM_TROPAS,   // Ataque inválido: atacante sem tropas
+    ATAQUE_VITORIA,      // Atacante conquistou o defensor
+    ATAQUE_DERROTA,      // Defensor repeliu o ataque
+    ATAQUE_EMPATE        // Dados iguais, nada muda
+} TipoResultado;
+
+typedef struct
+{
+    TipoResultado tipo;     // Desfecho do ataque
+    int dadoAtacante;       // Valor sorteado pelo atacante
+    int dadoDefensor;       // Valor sorteado pelo defensor
+    int tropasTransferidas; // Tropas que ficam no território conquistado
+} ResultadoAtaque;
+
+// ============================================================================
+// ENUM: TipoRegistro / ESTRUTURA: FluxoDeltas
+// Formato binário das mudanças de estado para visualizadores remotos.
+// O fluxo começa com 'W' 'D' VERSAO_FLUXO e segue com registros:
+//   REGISTRO_COR      id, tamanho, bytes          (nome da cor de um dono)
+//   REGISTRO_SNAPSHOT n, n x (tamanho, nome, dono, tropas)
+//   REGISTRO_DELTA    id do território, novo dono, variação de tropas
+// Todos os inteiros são varints (7 bits por byte); a variação de tropas usa
+// codificação zigzag para que valores negativos pequenos ocupem 1 byte.
+// ============================================================================
+typedef enum
+{
+    REGISTRO_COR = 1,
+    REGISTRO_SNAPSHOT = 2,
+    REGISTRO_DELTA = 3
+} TipoRegistro;
+
+typedef struct
+{
+    FILE *arquivo;                // Destino dos registros
+    int corEnviada[MAX_CORES];    // 1 se o nome da cor já foi enviado
+    long long bytesSnapshot;      // Tamanho da última fotografia completa
+    long long bytesDesdeSnapshot; // Bytes de deltas gravados depois dela
+} FluxoDeltas;
+
+// ============================================================================
+// ESTRUTURA: MapaCompacto
+// Armazenamento alternativo para mapas muito grandes, em colunas:
+// - dono empacotado com 1, 2, 4 ou 8 bits por território (o suficiente
+//   para a quantidade de cores), sem atravessar palavras de 64 bits
+// - tropas em 16 bits, com detecção de estouro
+// - nomes guardados uma única vez em um pool, sem espaço desperdiçado
+// - estado inicial (dono e tropas) em colunas frias separadas, que não
+//   ocupam cache durante os ataques
+// ============================================================================
+typedef struct
+{
+    int quantidade;               // Quantidade de territórios
+    int bitsDono;                 // Bits por dono em cada palavra de donos
+    unsigned long long *donos;    // Donos empacotados
+    unsigned short *tropas;       // Tropas de cada território
+    unsigned int *inicioNome;     // Posição do nome de cada território no pool
+    char *nomes;                  // Pool de nomes terminados em '\0'
+    size_t tamanhoNomes;          // Bytes usados no pool
+    unsigned char *donoInicial;   // (frio) Dono no cadastro
+    unsigned short *tropasInicial; // (frio) Tropas no cadastro
+} MapaCompacto;
+
+// ============================================================================
+// ESTRUTURA: Metricas
+// Contadores do jogo expostos no formato texto do Prometheus. Registrar uma
+// métrica é apenas um incremento de inteiro na cópia da thread, barato o
+// bastante para o caminho de cada ataque; as threads auxiliares juntam os
+// seus contadores com juntarMetricasThread() e a exportação soma tudo.
+// ============================================================================
+typedef struct
+{
+    long long partidasAtivas;                                    // Partidas em andamento
+    unsigned long long ataques;                                  // Ataques válidos resolvidos
+    unsigned long long conquistas;                               // Ataques que trocaram o dono
+    unsigned long long missoesCumpridas[TOTAL_MISSOES];          // Vitórias por ID de missão
+    unsigned long long faixasTurno[TOTAL_FAIXAS_LATENCIA + 1];   // Turnos por faixa de duração (+Inf no fim)
+    double somaDuracaoTurnos;                                    // Soma das durações em segundos
+    long long memoriaBytes;                                      // Memória de territórios e missões
+    double cpuTurnosSegundos;                                    // CPU dos turnos medidos (com limites)
+    unsigned long long turnosFreados;                            // Turnos que passaram do limite de CPU
+} Metricas;
+
+// ============================================================================
+// ESTRUTURA: HistogramaLog
+// Histograma com faixas logarítmicas (como o HDR Histogram): valores até
+// 2 * 2^BITS_SUBFAIXA têm faixa própria e, acima disso, cada potência de 2 é
+// dividida em 2^BITS_SUBFAIXA faixas. Qualquer quantil sai com erro relativo
+// menor que 1 / 2^BITS_SUBFAIXA, a memória é fixa e dois histogramas se
+// juntam somando as faixas.
+// ============================================================================
+typedef struct
+{
+    unsigned long long faixas[TOTAL_FAIXAS_LOG]; // Contagem por faixa
+    unsigned long long total;                    // Valores registrados
+    unsigned long long maior;                    // Maior valor registrado
+    double soma;                                 // Soma dos valores
+} HistogramaLog;
+
+// ============================================================================
+// ENUM: ComandoMenu / ESTRUTURA: LatenciasComandos
+// Tempo de resposta de cada comando do jogo interativo (opcional, com
+// --latencias): um HistogramaLog em nanossegundos por comando e um registro
+// da sessão com uma linha por execução ("instante comando microssegundos").
+// O tempo em que o jogo espera o jogador digitar não entra na conta.
+// A opção N do menu corresponde ao comando N - 1.
+// ============================================================================
+typedef enum
+{
+    COMANDO_EXIBIR,              // 1. Exibir territórios
+    COMANDO_ATACAR,              // 2. Realizar ataque
+    COMANDO_STATUS_MISSOES,      // 3. Verificar status das missões
+    COMANDO_SAIR,                // 4. Sair
+    COMANDO_DESFAZER,            // 5. Desfazer último ataque
+    COMANDO_REFAZER,             // 6. Refazer ataque desfeito
+    COMANDO_SUGERIR,             // 7. Sugerir melhor ataque
+    COMANDO_VERIFICAR_VENCEDOR,  // Verificação de vencedor depois de cada ação
+    TOTAL_COMANDOS
+} ComandoMenu;
+
+typedef struct
+{
+    HistogramaLog comandos[TOTAL_COMANDOS]; // Duração (ns) de cada comando
+    FILE *registro;                         // Registro da sessão
+    double inicioSessao;                    // Instante do início da sessão
+} LatenciasComandos;
+
+// ============================================================================
+// ESTRUTURAS: TerritorioDisputado / EstatisticasBatalhas
+// Estatísticas contínuas das batalhas, em memória fixa por mais batalhas
+// que sejam jogadas, e que podem ser juntadas entre threads e partidas:
+// - frequência de cada face do dado por jogador (para detectar um gerador
+//   aleatório defeituoso pelo qui-quadrado)
+// - ataques e conquistas por jogador (taxa de conquista)
+// - territórios mais atacados (algoritmo SpaceSaving com TOTAL_DISPUTADOS
+//   contadores: a contagem de cada um passa do valor real em no máximo "erro").
+//   A chave é (partida, ID do território): territórios de mesmo nome em
+//   partidas diferentes não se misturam. Uma tabela hash pela chave acha o
+//   contador; o menos atacado sai de uma varredura que continua de onde
+//   parou (as contagens só crescem, então cada contador é visto O(1) vezes
+//   por valor do mínimo: O(1) amortizado por ataque)
+// - distribuição das tropas envolvidas nas batalhas (HistogramaLog)
+// Os jogadores são identificados pelo ID da cor (idCor).
+// ============================================================================
+typedef struct
+{
+    int partida;                // Partida (marcarPartidaEstatisticas)
+    int territorio;             // ID do território na partida
+    char nome[MAX_NOME];        // Nome, para exibição
+    unsigned long long ataques; // Ataques recebidos (estimativa por cima)
+    unsigned long long erro;    // Quanto a contagem pode estar acima do real
+} TerritorioDisputado;
+
+typedef struct
+{
+    unsigned long long dados[MAX_CORES][MAX_FACES_ESTATISTICA]; // Faces tiradas por jogador
+    unsigned long long ataques[MAX_CORES];                      // Ataques feitos por jogador
+    unsigned long long conquistas[MAX_CORES];                   // Conquistas por jogador
+    TerritorioDisputado disputados[TOTAL_DISPUTADOS];           // Resumo SpaceSaving
+    int totalDisputados;                                        // Contadores em uso
+    int tabelaDisputados[2 * TOTAL_DISPUTADOS];                 // Chave -> contador + 1 (0 = livre)
+    unsigned long long menorDisputado;                          // Nenhum contador tem menos ataques
+    int cursorDisputados;                                       // Onde a busca do menos atacado continua
+    HistogramaLog tropas;                                       // Tropas de atacante e defensor
+    int partidaAtual;                                           // Partida das próximas batalhas
+    const Territorio *mapaAtual;                                // Mapa dela (ID = defensor - mapa)
+    int territoriosAtual;                                       // Tamanho desse mapa
+} EstatisticasBatalhas;
+
+// ============================================================================
+// ESTRUTURA: SorteioMissoes
+// Urna de IDs de missão (índices em missoesPredefinidas) compatíveis com o
+// tamanho do mapa. Cada sorteio tira uma missão da urna, sem reposição; só
+// quando todas saíram a urna é reabastecida. Assim nenhuma missão se repete
+// antes de a urna esvaziar. O sorteio pula as missões que o jogador já
+// cumpriu no mapa da preparação ou que não consegue cumprir; se nenhuma das
+// restantes serve, o jogador fica sem missão. Fica na pilha: sortear não
+// aloca nada.
+// ============================================================================
+typedef struct
+{
+    unsigned char restantes[TOTAL_MISSOES];   // Missões ainda na urna
+    int quantidadeRestantes;                  // Missões ainda na urna
+    unsigned char compativeis[TOTAL_MISSOES]; // Missões compatíveis com o mapa
+    int quantidadeCompativeis;                // Tamanho da urna cheia
+} SorteioMissoes;
+
+// ============================================================================
+// ESTRUTURAS: LimitesPartida / ConsumoPartida
+// Limites de recursos de uma categoria de partida hospedada e o consumo
+// medido de uma partida. A memória de territórios e missões é conferida ao
+// criar a partida (acima do limite, ela é recusada); a CPU de cada turno é
+// lida do relógio da thread e um turno acima do limite freia a partida:
+// ela espera o tempo que esse turno levaria usando só a sua cota de um
+// núcleo. Um limite 0 não é aplicado.
+// ============================================================================
+typedef struct
+{
+    const char *categoria;  // Nome da categoria
+    size_t memoriaMaxima;   // Bytes de territórios e missões aceitos
+    long long cpuTurnoNs;   // CPU de um turno antes de a partida ser freada
+    int cotaCpuPorMil;      // Fração de um núcleo (em milésimos) de uma partida freada
+} LimitesPartida;
+
+typedef struct
+{
+    size_t memoriaBytes;       // Memória de territórios e missões da partida
+    long long cpuTotalNs;      // CPU somada dos turnos medidos
+    long long cpuMaiorTurnoNs; // Turno mais caro
+    long long turnosMedidos;   // Turnos com CPU medida
+    long long turnosFreados;   // Turnos acima do limite de CPU
+    long long esperaFreioMs;   // Espera imposta pelos freios
+} ConsumoPartida;
+
+// ============================================================================
+// ESTRUTURA: Partida
+// Estado completo de uma partida que pode ser suspensa e retomada pelo
+// escalonador: além do mapa e das missões, guarda o gerador de números
+// aleatórios da própria partida, de quem é a vez e quando ela volta a jogar.
+// Uma partida parada (esperando um jogador lento) custa apenas esta estrutura.
+// ============================================================================
+typedef struct
+{
+    Territorio *mapa;                           // Territórios da partida
+    int quantidadeTerritorios;                  // Tamanho do mapa
+    int missoes[TOTAL_CORES_SIMULACAO];         // ID da missão de cada jogador (SEM_MISSAO se não houver)
+    int quantidadeJogadores;                    // Jogadores (um por cor de coresSimulacao)
+    int jogadorDaVez;                           // Próximo jogador a agir
+    int turnos;                                 // Turnos jogados
+    int vencedor;                               // Jogador vencedor (-1 enquanto não houver)
+    unsigned long long estadoAleatorio;         // Gerador próprio da partida
+    long long acordarEm;                        // Instante (ms virtuais) da próxima jogada
+    int atrasoJogador[TOTAL_CORES_SIMULACAO];   // Tempo (ms) que cada jogador leva para agir
+    int donoJogador[TOTAL_CORES_SIMULACAO];     // ID da cor de cada jogador
+    const RegrasJogo *regras;                   // Versão das regras fixada ao criar a partida
+    const LimitesPartida *limites;              // Limites da categoria (NULL = sem limites)
+    ConsumoPartida consumo;                     // Memória e CPU usadas pela partida
+    int numero;                                 // Ordem no lote do escalonador (semente + numero)
+} Partida;
+
+// ============================================================================
+// ESTRUTURA: SessaoLockstep
+// Um lado de uma partida em rede por lockstep: os dois pares guardam a
+// mesma Partida e só trocam comandos. A cada turno cada par envia uma
+// mensagem curta (MAX_MENSAGEM_LOCKSTEP bytes no máximo) com o número do
+// turno, o comando do jogador da vez (se ele for deste par) e 32 bits da
+// soma de verificação do estado; somas diferentes denunciam dessincronia.
+// ============================================================================
+typedef struct
+{
+    Partida partida;                                 // Estado idêntico nos dois pares
+    unsigned long long somaMapa;                     // Soma dos hashes de (ID, dono, tropas)
+    unsigned long long estadoEscolhas;               // Gerador privado dos jogadores locais
+    int conexao;                                     // Socket com o outro par (-1 = encerrada)
+    int jogadoresLocais;                             // Bit j ligado: o jogador j é deste par
+    int enviado;                                     // Mensagem do turno atual já enviada
+    int atacante;                                    // Comando local do turno (-1 = passa)
+    int defensor;
+    unsigned char recebido[2 * MAX_MENSAGEM_LOCKSTEP]; // Bytes recebidos ainda não usados
+    int tamanhoRecebido;
+    long long bytesEnviados;                         // Tráfego deste par
+    int dessincronizada;                             // Somas diferentes detectadas
+    int lado;                                        // 0: jogadores pares, 1: ímpares
+    int turnoComFalha;                               // Turno adulterado pelo lado 1 (teste, -1 = nunca);
+                                                     // a sessão não termina antes dele
+} SessaoLockstep;
+
+// ============================================================================
+// ESTRUTURA: ArenaPartida
+// Orçamento de memória de uma partida, reservado de uma vez ao criá-la. O
+// mapa, as missões, o diário e o índice de nomes saem deste bloco, e nada
+// mais é alocado durante os turnos: falta de memória aparece ao criar a
+// partida (reservarArena), nunca no meio de um turno. Os blocos não são
+// devolvidos um a um; liberar a partida é liberar a arena.
+// ============================================================================
+typedef struct
+{
+    unsigned char *bloco; // Memória reservada (já tocada, páginas garantidas)
+    size_t capacidade;    // Bytes reservados
+    size_t usado;         // Bytes já entregues
+} ArenaPartida;
+
+// ============================================================================
+// ESTRUTURAS: AlteracaoTerritorio / DiarioAlteracoes
+// Diário das mudanças feitas no mapa, para desfazer e refazer jogadas ou
+// testar uma jogada hipotética e voltar atrás. Cada alteração guarda só o
+// território tocado, antes e depois, então o custo é proporcional ao que
+// mudou e não ao tamanho do mapa. Uma jogada é um grupo de alterações
+// fechado por concluirAlteracoes().
+// ============================================================================
+typedef struct
+{
+    int id;                  // Território alterado
+    int inicioJogada;        // 1 na primeira alteração de cada jogada
+    int donoAntes;           // Estado antes da jogada
+    int tropasAntes;
+    int donoDepois;          // Estado depois da jogada (preenchido ao concluir)
+    int tropasDepois;
+} AlteracaoTerritorio;
+
+typedef struct
+{
+    AlteracaoTerritorio *alteracoes; // Alterações em ordem
+    int aplicadas;                   // Alterações valendo no mapa
+    int total;                       // Aplicadas + desfeitas que ainda podem ser refeitas
+    int concluidas;                  // Alterações já com o estado "depois"
+    int capacidade;                  // Espaço alocado
+    ArenaPartida *arena;             // Origem da memória (NULL = malloc, o diário cresce)
+} DiarioAlteracoes;
+
+// ============================================================================
+// ESTRUTURAS: BlocoTerritorios / MapaRamificado
+// Mapa dividido em blocos de TERRITORIOS_POR_BLOCO com cópia na escrita:
+// ramificar() cria um ramo que compartilha todos os blocos com a origem, e
+// um bloco só é copiado quando um dos ramos altera um território dele.
+// Bots que exploram várias jogadas mantêm muitos ramos vivos ao mesmo tempo
+// pagando apenas pelos blocos que cada ramo mudou.
+// ============================================================================
+typedef struct
+{
+    int referencias;                                 // Ramos que usam este bloco
+    Territorio territorios[TERRITORIOS_POR_BLOCO];
+} BlocoTerritorios;
+
+typedef struct
+{
+    BlocoTerritorios **blocos; // Blocos (possivelmente compartilhados)
+    int quantidadeBlocos;
+    int quantidadeTerritorios;
+} MapaRamificado;
+
+// ============================================================================
+// ESTRUTURA: AmbientesWar
+// Lote de ambientes de treino (estilo gym) com as regras do Mestre. O agente
+// é sempre o jogador 0 (coresSimulacao[0]); os demais são bots com
+// jogadaAleatoria(). Os mapas de todos os ambientes ficam em um único bloco
+// contíguo e todos avançam juntos a cada passoAmbientes().
+//   Ação:       idAtacante * territorios + idDefensor, ou ACAO_PASSAR
+//   Observação: VALORES_OBSERVACAO por território: dono (0 = agente,
+//               j = jogador j) e tropas, gravados no buffer de quem chama
+//   Recompensa: +1 se a missão do agente for cumprida, -1 se a de outro
+//               jogador for, 0 nos demais passos
+// Um ambiente que termina é reiniciado sozinho e devolve a observação inicial
+// do episódio seguinte.
+// ============================================================================
+typedef struct
+{
+    int quantidade;                         // Ambientes no lote
+    int quantidadeTerritorios;              // Territórios de cada mapa
+    int quantidadeJogadores;                // Jogadores de cada ambiente (agente + bots)
+    int donoJogador[TOTAL_CORES_SIMULACAO]; // ID da cor de cada jogador
+    Territorio *mapas;                      // quantidade x quantidadeTerritorios, contíguos
+    int *missoes;                           // quantidade x quantidadeJogadores (IDs de missão)
+    unsigned long long *estadosAleatorios;  // Gerador próprio de cada ambiente
+    int *turnos;                            // Turnos do episódio atual
+} AmbientesWar;
+
+// ============================================================================
+// ESTRUTURAS: CabecalhoCenario / Cenario
+// Pacote de cenário: mapa, cores e missões de uma partida pronta em um único
+// bloco, lido do disco de uma vez e usado no lugar, sem interpretar texto:
+//   CabecalhoCenario
+//   territórios  quantidadeTerritorios x Territorio (o layout da memória)
+//   cores        totalCores x MAX_COR (nome da cor de cada dono do pacote)
+//   missões      quantidadeJogadores x int: ID da missão (SEM_MISSAO se não
+//                houver), usado no lugar
+// Cada seção começa em múltiplo de ALINHAMENTO_CENARIO. Ao carregar, só os
+// IDs das cores (que dependem do processo) são corrigidos. O
+// pacote vale para a plataforma que o gerou (bytesTerritorio e a versão,
+// lida na ordem de bytes local, são conferidos).
+// ============================================================================
+typedef struct
+{
+    char magica[4];                       // 'W' 'C' 'E' 'N'
+    unsigned int versao;                  // VERSAO_CENARIO
+    unsigned int bytesTerritorio;         // sizeof(Territorio) de quem gerou
+    unsigned int quantidadeTerritorios;
+    unsigned int quantidadeJogadores;
+    unsigned int totalCores;              // Cores na seção de cores
+    unsigned long long inicioTerritorios; // Posição de cada seção no pacote
+    unsigned long long inicioCores;
+    unsigned long long inicioMissoes;
+    unsigned long long tamanho;           // Bytes do pacote inteiro
+} CabecalhoCenario;
+
+typedef struct
+{
+    void *bloco;               // Pacote inteiro (uma única alocação)
+    Territorio *mapa;          // Territórios, dentro do bloco
+    int quantidadeTerritorios;
+    int *missoes;              // ID da missão de cada jogador, dentro do bloco
+    int quantidadeJogadores;
+} Cenario;
+
+// ============================================================================
+// ESTRUTURA: IndiceNomes
+// Índice dos nomes dos territórios, montado uma vez depois do cadastro (os
+// nomes não mudam durante o jogo). Maiúsculas e minúsculas não diferem.
+// - tabela: hash com sondagem linear; cada posição guarda 32 bits do hash do
+//   nome (parte alta) e ID + 1 (parte baixa, 0 = livre), então só o nome
+//   certo é lido do mapa: um nome exato custa um hash e uma comparação
+// - ordenados: IDs em ordem alfabética; os nomes que começam com um prefixo
+//   ficam juntos e são achados com duas buscas binárias
+// ============================================================================
+typedef struct
+{
+    const Territorio *mapa;     // Mapa indexado (não pertence ao índice)
+    int quantidade;             // Territórios indexados
+    unsigned long long *tabela; // Hash dos nomes (2^k posições, no máximo meio cheio)
+    unsigned int mascara;       // 2^k - 1
+    int *ordenados;             // IDs em ordem alfabética dos nomes
+    ArenaPartida *arena;        // Origem da memória (NULL = malloc)
+} IndiceNomes;
+
+// ============================================================================
+// ESTRUTURA: OrdemTerritorios
+// Nova ordem dos territórios no vetor do mapa, escolhida para que
+// territórios que se enfrentam fiquem próximos na memória. O ID externo
+// (o do cadastro, usado por jogadores, arquivos e visualizadores) não muda;
+// só a posição no vetor (ID interno).
+// ============================================================================
+typedef struct
+{
+    int *interno;   // interno[idExterno] = posição no mapa reordenado
+    int *externo;   // externo[posição] = ID externo do território
+    int quantidade; // Territórios
+} OrdemTerritorios;
+
+// ============================================================================
+// ESTRUTURA: HistoricoMapa
+// Dono e tropas de todos os territórios em cada turno, para gráficos e para
+// consultar o mapa de qualquer turno. Os turnos ficam em trechos de
+// intervaloQuadros turnos: cada trecho começa com um quadro completo do mapa
+// (dono e tropas em varint) e segue com as mudanças de cada turno
+// (ID + 1, novo dono + 1 ou 0 se não mudou, variação de tropas em zigzag;
+// um 0 fecha o turno). Consultar o turno T decodifica um quadro e no máximo
+// intervaloQuadros turnos de mudanças. Ao passar de limiteBytes os trechos
+// mais antigos são descartados, então a memória não cresce com a partida.
+// ============================================================================
+typedef struct
+{
+    unsigned char *dados;  // Quadro do primeiro turno, depois as mudanças dos turnos seguintes
+    size_t tamanho;        // Bytes usados
+    size_t capacidade;     // Bytes alocados
+    size_t inicioMudancas; // Onde terminam o quadro e começam as mudanças
+} TrechoHistorico;
+
+typedef struct
+{
+    int quantidadeTerritorios;
+    int quantidadeJogadores;
+    int donoJogador[TOTAL_CORES_SIMULACAO]; // ID da cor de cada jogador (para as séries)
+    int intervaloQuadros;                   // Turnos entre dois quadros completos
+    size_t limiteBytes;                     // Memória máxima dos trechos
+    int *donos;                             // Estado do último turno gravado
+    int *tropas;
+    TrechoHistorico *trechos;               // Trechos ainda guardados, do mais antigo ao atual
+    int quantidadeTrechos;
+    int capacidadeTrechos;
+    int primeiroTrecho;                     // Número do trechos[0] (trecho n começa no turno n x intervalo)
+    int turnoAtual;                         // Último turno gravado (0 = mapa inicial)
+    size_t bytes;                           // Bytes alocados pelos trechos
+} HistoricoMapa;
+
+// ============================================================================
+// ESTRUTURAS: ChancesAtaque / SugestaoAtaque / AnaliseAtaques
+// Análise de todos os ataques possíveis de um jogador. As chances vêm da
+// contagem exata dos pares de dados (15/36 de vitória com dados de 6
+// faces). Uma vitória só muda o defensor e uma derrota só muda o atacante,
+// então o valor de um ataque é a soma de uma parte do defensor e uma do
+// atacante: cada território é avaliado uma vez, com as medidas do mapa
+// guardadas em AnaliseAtaques, e os melhores pares saem dos melhores de
+// cada lado. Os vetores das sequências são reservados ao criar a partida.
+// ============================================================================
+typedef struct
+{
+    int vitorias; // Pares de dados em que o atacante vence
+    int derrotas; // Pares em que o defensor vence
+    int empates;  // Pares iguais
+    int total;    // facesDado x facesDado
+} ChancesAtaque;
+
+typedef struct
+{
+    int atacante;              // ID do território atacante
+    int defensor;              // ID do território defensor
+    double progressoVitoria;   // Progresso da missão (0 a 1, 1 = cumprida) se o ataque vencer
+    double progressoDerrota;   // Progresso se o ataque perder
+    double progressoEsperado;  // Variação esperada do progresso, pesada pelas chances
+    double chanceCumprir;      // Chance de a missão estar cumprida depois do ataque
+} SugestaoAtaque;
+
+typedef struct
+{
+    int quantidade;                 // Territórios cobertos pelos vetores
+    int *inicioSequencia;           // Primeiro território da sequência do jogador
+    int *fimSequencia;              // Último território da sequência
+    int maioresSequencias[2];       // Início das duas maiores sequências (-1 = nenhuma)
+    int contagemCores[MAX_CORES];   // Territórios de cada cor
+    int maioresTropas[2];           // Os dois territórios do jogador com mais tropas (-1 = nenhum)
+    int alvoInicial;                // Território com maior número inicial de tropas (-1 = nenhum)
+    ArenaPartida *arena;            // Origem dos vetores (NULL = malloc)
+} AnaliseAtaques;
+
+// ============================================================================
+// DADOS GLOBAIS DO NÚCLEO
+// ============================================================================
+extern char *missoesPredefinidas[];        // Missões estratégicas (war_core.c)
+extern const RegrasJogo REGRAS_NOVATO;      // Regras de cada nível (war_core.c)
+extern const RegrasJogo REGRAS_AVENTUREIRO;
+extern const RegrasJogo REGRAS_MESTRE;
+extern const LimitesPartida LIMITES_CASUAL;   // Limites de cada categoria (war_limites.c)
+extern const LimitesPartida LIMITES_RANQUEADA;
+extern const LimitesPartida LIMITES_TORNEIO;
+extern _Thread_local const RegrasJogo *regras; // Regras em uso, por thread
+extern char tabelaCores[MAX_CORES][MAX_COR]; // Cores com ID de dono (war_cores.c)
+extern int totalCores;
+extern int idVermelho;                      // ID de qualquer grafia de vermelho (-1 se não houver)
+extern _Thread_local Metricas metricas;     // Métricas do jogo, por thread (war_metricas.c)
+extern const double limitesFaixasTurno[TOTAL_FAIXAS_LATENCIA];
+extern const char *nomesComandos[TOTAL_COMANDOS]; // Nomes dos comandos no registro (war_metricas.c)
+extern const char *coresSimulacao[];        // Cores das partidas simuladas (war_simulacao.c)
+extern const char *coresVerificacao[];      // Cores da verificação de regras (war_simulacao.c)
+extern const char *propriedadesRegras[];    // Propriedades verificadas (war_simulacao.c)
+extern _Thread_local EstatisticasBatalhas *estatisticasBatalhas; // Destino das batalhas, ou NULL (war_estatisticas.c)
+
+// ============================================================================
+// PROTÓTIPOS DAS FUNÇÕES
+// ============================================================================
+// Regras, sorteio e territórios (war_core.c):
+void usarRegras(const RegrasJogo *novasRegras);
+void semearAleatorio(unsigned long long semente);
+unsigned int proximoAleatorio();
+unsigned int proximoAleatorioDe(unsigned long long *estado);
+unsigned long long salvarAleatorio();
+void restaurarAleatorio(unsigned long long estado);
+int lancarDado();
+void cadastrarTerritorios(Territorio *territorios, int quantidade);
+void exibirTerritorios(Territorio *territorios, int quantidade);
+int selecionarTerritorio(int quantidade, const char *mensagem);
+ResultadoAtaque resolverAtaque(Territorio *atacante, Territorio *defensor);
+void atacar(Territorio *atacante, Territorio *defensor);
+
+// Registro de cores (war_cores.c):
+void normalizarCor(const char *cor, char *chave);
+int idCor(const char *cor);
+
+// Missões (war_core.c):
+void iniciarSorteioMissoes(SorteioMissoes *sorteio, int tamanhoMapa);
+int sortearMissao(SorteioMissoes *sorteio, unsigned long long *estado, Territorio *mapa, int tamanho,
+                  int donoJogador);
+void sortearMissoesJogadores(SorteioMissoes *sorteio, unsigned long long *estado, Territorio *mapa, int tamanho,
+                             const int *donos, int *missoes, int quantidadeJogadores);
+int coresDosJogadores(const Territorio *mapa, int tamanho, int *donos, int quantidadeJogadores);
+void exibirMissao(int missao, const char *nomeJogador);
+void descreverMissao(int missao, char *texto, size_t tamanho);
+int verificarMissao(int missao, const Territorio *mapa, int tamanho, int donoJogador);
+int verificarVencedor(const int *missoes, const int *donos, Territorio *mapa, int quantidadeJogadores,
+                      int quantidadeTerritorios);
+
+// Fluxo binário de deltas (war_codec.c):
+int escreverVarint(unsigned char *buffer, unsigned int valor);
+int lerVarint(FILE *arquivo, unsigned int *valor);
+int lerVarintMemoria(const unsigned char *buffer, size_t tamanho, size_t *posicao, unsigned int *valor);
+int codificarDelta(unsigned char *buffer, int id, int dono, int variacaoTropas);
+int iniciarFluxoDeltas(FluxoDeltas *fluxo, FILE *arquivo);
+int enviarSnapshot(FluxoDeltas *fluxo, const Territorio *mapa, int quantidade);
+int enviarDelta(FluxoDeltas *fluxo, const Territorio *mapa, int quantidade,
+                int id, int donoAnterior, int tropasAnteriores);
+int decodificarFluxo(FILE *arquivo, Territorio **mapa, int *quantidade);
+
+// Métricas (war_metricas.c):
+double agoraSegundos();
+void registrarDuracaoTurno(double segundos);
+void juntarMetricasThread(void);
+Metricas lerMetricas(void);
+int exportarMetricas(const char *caminho);
+int iniciarLatencias(LatenciasComandos *latencias, const char *caminho);
+void registrarLatencia(LatenciasComandos *latencias, ComandoMenu comando, double segundos);
+void encerrarLatencias(LatenciasComandos *latencias);
+
+// Armazenamento compacto (war_compacto.c):
+int criarMapaCompacto(MapaCompacto *compacto, const Territorio *mapa, int quantidade);
+int donoCompacto(const MapaCompacto *compacto, int id);
+void definirDonoCompacto(MapaCompacto *compacto, int id, int dono);
+int alterarTropasCompacto(MapaCompacto *compacto, int id, int variacao);
+ResultadoAtaque resolverAtaqueCompacto(MapaCompacto *compacto, int idAtacante, int idDefensor);
+size_t bytesMapaCompacto(const MapaCompacto *compacto);
+void liberarMapaCompacto(MapaCompacto *compacto);
+int compararArmazenamento(int quantidade, int quantidadeJogadores);
+
+// Varreduras vetorizadas das missões no mapa compacto (war_vetorial.c):
+int maiorTropasDonoCompacto(const MapaCompacto *compacto, int dono, int limite);
+int contarDonoCompacto(const MapaCompacto *compacto, int dono, int limite);
+int sequenciaDonoCompacto(const MapaCompacto *compacto, int dono, int tamanho);
+int verificarMissaoCompacto(int missao, const MapaCompacto *compacto, int donoJogador);
+
+// Simulação e verificação de regras (war_simulacao.c):
+void gerarMapaAleatorio(Territorio *mapa, int quantidade, int quantidadeJogadores);
+int simularPartida(unsigned long long semente, int quantidadeTerritorios,
+                   int quantidadeJogadores, int *turnos, int *missaoVencedora);
+int simularPartidas(unsigned long long sementeInicial, int quantidadeJogos,
+                    int quantidadeTerritorios, int quantidadeJogadores);
+int verificarRegras(unsigned long long semente, long long acoes, const char *arquivoCorpus);
+int reproduzirCorpus(const char *arquivoCorpus);
+double medirDesempenho(unsigned long long semente, long long turnos,
+                       int quantidadeTerritorios, int quantidadeJogadores);
+
+// Escalonador de partidas concorrentes (war_escalonador.c):
+int criarPartida(Partida *partida, unsigned long long semente, int quantidadeTerritorios,
+                 int quantidadeJogadores, int percentualHumanos, const LimitesPartida *limites);
+size_t memoriaPartida(int quantidadeTerritorios);
+int escolherJogada(const Territorio *mapa, int quantidade, int donoJogador, int *idDefensor);
+int jogadaAleatoria(Territorio *mapa, int quantidade, int donoJogador, int *idDefensor);
+int jogarTurno(Partida *partida);
+void liberarPartida(Partida *partida);
+int executarPartidas(unsigned long long semente, int quantidadeJogos, int quantidadeTerritorios,
+                     int quantidadeJogadores, int percentualHumanos, const char *arquivoRegras,
+                     const LimitesPartida *limites);
+
+// Partidas em rede por lockstep (war_lockstep.c):
+int executarLockstep(unsigned long long semente, int quantidadeSessoes, int quantidadeTerritorios,
+                     int quantidadeJogadores, int sessaoComFalha);
+
+// Ambientes de treino (war_ambiente.c):
+int criarAmbientes(AmbientesWar *ambientes, int quantidade, int quantidadeTerritorios,
+                   int quantidadeJogadores, unsigned long long semente);
+void reiniciarAmbiente(AmbientesWar *ambientes, int indice, float *observacao);
+void observarAmbiente(const AmbientesWar *ambientes, int indice, float *observacao);
+void passoAmbiente(AmbientesWar *ambientes, int indice, int acao, float *observacao,
+                   float *recompensa, unsigned char *terminado);
+void passoAmbientes(AmbientesWar *ambientes, const int *acoes, float *observacoes,
+                    float *recompensas, unsigned char *terminados);
+void liberarAmbientes(AmbientesWar *ambientes);
+int medirAmbientes(unsigned long long semente, int quantidade, long long passos,
+                   int quantidadeTerritorios, int quantidadeJogadores);
+
+// Estatísticas contínuas das batalhas (war_estatisticas.c):
+void registrarValorHistograma(HistogramaLog *histograma, unsigned long long valor);
+unsigned long long quantilHistograma(const HistogramaLog *histograma, double quantil);
+void juntarHistogramas(HistogramaLog *destino, const HistogramaLog *origem);
+void marcarPartidaEstatisticas(EstatisticasBatalhas *estatisticas, int partida, const Territorio *mapa,
+                               int quantidade);
+void registrarBatalha(EstatisticasBatalhas *estatisticas, const Territorio *atacante,
+                      const Territorio *defensor, int dadoAtacante, int dadoDefensor);
+void juntarEstatisticas(EstatisticasBatalhas *destino, const EstatisticasBatalhas *origem);
+double quiQuadradoDados(const EstatisticasBatalhas *estatisticas, int jogador, int faces);
+double limiteQuiQuadrado(int grausLiberdade);
+void exibirEstatisticas(const EstatisticasBatalhas *estatisticas);
+void exportarEstatisticas(FILE *arquivo, const EstatisticasBatalhas *estatisticas);
+
+// Pacotes de cenário (war_cenario.c):
+int salvarCenario(const char *caminho, const Territorio *mapa, int quantidadeTerritorios,
+                  const int *missoes, int quantidadeJogadores);
+int lerCabecalhoCenario(CabecalhoCenario *cabecalho, const char *caminho);
+int carregarCenario(Cenario *cenario, const char *caminho);
+void liberarCenario(Cenario *cenario);
+int gerarCenario(const char *caminho, unsigned long long semente, int quantidadeTerritorios,
+                 int quantidadeJogadores);
+
+// Orçamento de memória de uma partida (war_arena.c):
+int reservarArena(ArenaPartida *arena, size_t capacidade);
+void *alocarArena(ArenaPartida *arena, size_t tamanho);
+void *alocarDe(ArenaPartida *arena, size_t tamanho);
+void liberarDe(ArenaPartida *arena, void *ponteiro);
+void liberarArena(ArenaPartida *arena);
+size_t orcamentoJogo(int quantidadeTerritorios, int quantidadeJogadores, int capacidadeDiario, int incluirMapa);
+
+// Limites de recursos por categoria de partida (war_limites.c):
+const LimitesPartida *buscarLimites(const char *categoria);
+int conferirMemoria(const LimitesPartida *limites, size_t bytes);
+long long cpuThreadNs(void);
+long long registrarCpuTurno(ConsumoPartida *consumo, const LimitesPartida *limites, long long cpuNs);
+void juntarConsumo(ConsumoPartida *destino, const ConsumoPartida *origem);
+void esperarFreio(long long milissegundos);
+
+// Regras recarregáveis de um arquivo (war_regras.c):
+int lerRegras(const char *caminho, VersaoRegras *versao, int *linhaErro);
+int recarregarRegras(const char *caminho, int *linhaErro);
+const RegrasJogo *fixarRegras(void);
+void soltarRegras(const RegrasJogo *fixadas);
+unsigned int versaoPublicada(void);
+
+// Índice dos nomes dos territórios (war_nomes.c):
+unsigned long long hashNome(const char *nome, unsigned long long semente);
+int construirIndiceNomes(IndiceNomes *indice, const Territorio *mapa, int quantidade, ArenaPartida *arena);
+size_t bytesIndiceNomes(int quantidade);
+int buscarNome(const IndiceNomes *indice, const char *nome);
+int buscarPrefixo(const IndiceNomes *indice, const char *prefixo, int *primeiro);
+int resolverTerritorio(const IndiceNomes *indice, const char *texto, int *id);
+int selecionarTerritorioPorNome(const IndiceNomes *indice, const char *mensagem, int *segundo);
+void liberarIndiceNomes(IndiceNomes *indice);
+
+// Ordem dos territórios na memória (war_ordem.c):
+int calcularOrdemPorVizinhos(OrdemTerritorios *ordem, int quantidade, const int *pares, int quantidadePares);
+int aplicarOrdem(const OrdemTerritorios *ordem, Territorio *mapa);
+void liberarOrdem(OrdemTerritorios *ordem);
+int compararOrdemTerritorios(int lado, int ataques);
+
+// Análise dos melhores ataques (war_analise.c):
+ChancesAtaque chancesAtaque(void);
+int iniciarAnalise(AnaliseAtaques *analise, int quantidade, ArenaPartida *arena);
+size_t bytesAnalise(int quantidade);
+void liberarAnalise(AnaliseAtaques *analise);
+double progressoMissao(int missao, const Territorio *mapa, int tamanho, int donoJogador);
+int analisarAtaques(AnaliseAtaques *analise, int missao, const Territorio *mapa, int tamanho,
+                    int donoJogador, SugestaoAtaque *sugestoes, int maximo);
+int analisarAtaquesExaustivo(int missao, Territorio *mapa, int tamanho, int donoJogador,
+                             SugestaoAtaque *sugestoes, int maximo);
+void exibirSugestoes(const SugestaoAtaque *sugestoes, int quantidade, int missao,
+                     const Territorio *mapa, int tamanho, int donoJogador);
+int medirAnalise(unsigned long long semente, int quantidadeTerritorios, int quantidadeJogadores);
+
+// Histórico comprimido do mapa (war_historico.c):
+int criarHistorico(HistoricoMapa *historico, const Territorio *mapa, int quantidadeTerritorios,
+                   int quantidadeJogadores, const int *donoJogador, int intervaloQuadros, size_t limiteBytes);
+int registrarTurnoHistorico(HistoricoMapa *historico, const Territorio *mapa, const int *ids, int quantidadeIds);
+int primeiroTurnoHistorico(const HistoricoMapa *historico);
+int consultarTurno(const HistoricoMapa *historico, int turno, Territorio *mapa);
+int serieJogadores(const HistoricoMapa *historico, int turnoInicial, int turnoFinal, int passo,
+                   int *territorios, long long *tropas);
+void liberarHistorico(HistoricoMapa *historico);
+int medirHistorico(unsigned long long semente, int turnos, int quantidadeTerritorios, int quantidadeJogadores,
+                   int intervaloQuadros, int limiteMegabytes);
+
+// Diário de alterações e ramos do mapa (war_diario.c):
+int iniciarDiario(DiarioAlteracoes *diario, int capacidade, ArenaPartida *arena);
+int anotarAlteracao(DiarioAlteracoes *diario, const Territorio *mapa, int id);
+void concluirAlteracoes(DiarioAlteracoes *diario, const Territorio *mapa);
+ResultadoAtaque atacarComDiario(DiarioAlteracoes *diario, Territorio *mapa, int idAtacante, int idDefensor);
+int desfazerJogada(DiarioAlteracoes *diario, Territorio *mapa);
+int refazerJogada(DiarioAlteracoes *diario, Territorio *mapa);
+void reverterAteMarca(DiarioAlteracoes *diario, Territorio *mapa, int marca);
+void liberarDiario(DiarioAlteracoes *diario);
+int criarRamo(MapaRamificado *ramo, const Territorio *mapa, int quantidade);
+int ramificar(MapaRamificado *destino, const MapaRamificado *origem);
+const Territorio *territorioRamo(const MapaRamificado *ramo, int id);
+Territorio *alterarRamo(MapaRamificado *ramo, int id);
+void liberarRamo(MapaRamificado *ramo);
+
+#endif
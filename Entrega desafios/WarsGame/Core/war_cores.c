@@ -0,0 +1,160 @@
+// NÚCLEO DO JOGO DE GUERRA - REGISTRO DE CORES
+//
+// OBJETIVO:
+// Transformar a cor digitada em um ID pequeno (o dono do território) uma
+// única vez, na entrada. Antes de ser registrada a cor é normalizada:
+// - espaços nas pontas são ignorados e espaços repetidos viram um só
+// - maiúsculas viram minúsculas e os acentos (UTF-8) são removidos
+// - a forma feminina das cores conhecidas vira a masculina
+// Assim "Vermelha", " VERMELHO " e "vermelho" são o mesmo jogador, e as
+// regras comparam apenas inteiros.
+//
+// O registro é global: em programas com várias threads as cores devem ser
+// registradas antes (idCor só escreve na tabela ao ver uma cor nova).
+
+#include <string.h>
+
+#include "war_core.h"
+
+#define BITS_INDICE_CORES 7       // Índice de cores com 2^7 posições (o dobro de MAX_CORES)
+#define BITS_FORMAS_FEMININAS 4   // Tabela de formas femininas com 2^4 posições
+#define SEMENTE_FORMAS_FEMININAS 7 // Semente que espalha as formas sem colisão
+
+// ============================================================================
+// TABELA DE CORES
+// Associa cada cor em jogo a um ID pequeno (o "dono" nos territórios e nos
+// registros binários). O nome exibido é a primeira grafia registrada.
+// ============================================================================
+char tabelaCores[MAX_CORES][MAX_COR];
+int totalCores = 0;
+int idVermelho = -1;
+
+static char chavesCores[MAX_CORES][MAX_COR];                // Cor normalizada de cada ID
+static unsigned char indiceCores[1 << BITS_INDICE_CORES];   // ID + 1 (0 = posição livre)
+
+// ============================================================================
+// LETRAS SEM ACENTO
+// Para o segundo byte das letras acentuadas em UTF-8 (0xC3 0x80 a 0xC3 0xBF,
+// de "À" a "ÿ"); '.' marca os caracteres que não são letras acentuadas
+// ============================================================================
+static const char semAcento[] = "aaaaaa.ceeeeiiii"
+                                "dnooooo.ouuuuy.."
+                                "aaaaaa.ceeeeiiii"
+                                "dnooooo.ouuuuy.y";
+
+// ============================================================================
+// FORMAS FEMININAS DAS CORES
+// Hash perfeito: cada forma está na posição hashNome(forma, SEMENTE) >> 60,
+// sem colisões, então a busca é um hash e uma comparação. Ao mudar a lista,
+// escolha de novo a semente e as posições.
+// ============================================================================
+static const char *const formasFemininas[1 << BITS_FORMAS_FEMININAS][2] = {
+    [2] = {"cinzenta", "cinzento"},
+    [3] = {"castanha", "castanho"},
+    [4] = {"vermelha", "vermelho"},
+    [5] = {"dourada", "dourado"},
+    [6] = {"roxa", "roxo"},
+    [7] = {"amarela", "amarelo"},
+    [8] = {"branca", "branco"},
+    [9] = {"prateada", "prateado"},
+    [13] = {"preta", "preto"}};
+
+// ============================================================================
+// FUNÇÃO: normalizarCor
+// DESCRIÇÃO: Escreve a forma normalizada de uma cor: sem espaços sobrando,
+//            minúscula, sem acentos e no masculino
+// PARÂMETROS: cor (como foi digitada), chave (saída, MAX_COR bytes)
+// ============================================================================
+void normalizarCor(const char *cor, char *chave)
+{
+    const unsigned char *c = (const unsigned char *)cor;
+    int tamanho = 0;
+    int espaco = 0;
+
+    for (; *c != '\0'; c++)
+    {
+        unsigned char letra = *c;
+        if (letra == ' ' || letra == '\t' || letra == '\n' || letra == '\r')
+        {
+            espaco = 1;
+            continue;
+        }
+
+        if (letra == 0xC3 && c[1] >= 0x80 && c[1] <= 0xBF && semAcento[c[1] - 0x80] != '.')
+        {
+            letra = (unsigned char)semAcento[*++c - 0x80];
+        }
+        else if (letra >= 'A' && letra <= 'Z')
+        {
+            letra = (unsigned char)(letra - 'A' + 'a');
+        }
+
+        if (espaco && tamanho > 0 && tamanho < MAX_COR - 1)
+        {
+            chave[tamanho++] = ' ';
+        }
+        espaco = 0;
+        if (tamanho < MAX_COR - 1)
+        {
+            chave[tamanho++] = (char)letra;
+        }
+    }
+    chave[tamanho] = '\0';
+
+    const char *const *forma = formasFemininas[hashNome(chave, SEMENTE_FORMAS_FEMININAS) >>
+                                               (64 - BITS_FORMAS_FEMININAS)];
+    if (forma[0] != NULL && strcmp(forma[0], chave) == 0)
+    {
+        strcpy(chave, forma[1]);
+    }
+}
+
+// ============================================================================
+// FUNÇÃO: idCor
+// DESCRIÇÃO: Retorna o ID da cor, registrando-a se for nova. Grafias que
+//            normalizam para a mesma cor recebem o mesmo ID.
+// PARÂMETROS: cor (nome da cor como foi digitada)
+// RETORNO: ID da cor (0 a MAX_CORES - 1) ou -1 se a tabela estiver cheia
+// ============================================================================
+int idCor(const char *cor)
+{
+    char chave[MAX_COR];
+    normalizarCor(cor, chave);
+
+    // Sondagem linear: o índice nunca passa da metade ocupado
+    unsigned int mascara = (1u << BITS_INDICE_CORES) - 1;
+    unsigned int posicao = (unsigned int)(hashNome(chave, 0) >> (64 - BITS_INDICE_CORES));
+    for (; indiceCores[posicao] != 0; posicao = (posicao + 1) & mascara)
+    {
+        if (strcmp(chavesCores[indiceCores[posicao] - 1], chave) == 0)
+        {
+            return indiceCores[posicao] - 1;
+        }
+    }
+
+    if (totalCores == MAX_CORES)
+    {
+        return -1;
+    }
+
+    // O nome exibido é a grafia digitada, sem os espaços das pontas
+    while (*cor == ' ' || *cor == '\t')
+    {
+        cor++;
+    }
+    strncpy(tabelaCores[totalCores], cor, MAX_COR - 1);
+    tabelaCores[totalCores][MAX_COR - 1] = '\0';
+    for (int fim = (int)strlen(tabelaCores[totalCores]) - 1;
+         fim >= 0 && strchr(" \t\r\n", tabelaCores[totalCores][fim]) != NULL; fim--)
+    {
+        tabelaCores[totalCores][fim] = '\0';
+    }
+
+    strcpy(chavesCores[totalCores], chave);
+    indiceCores[posicao] = (unsigned char)(totalCores + 1);
+    if (strcmp(chave, "vermelho") == 0)
+    {
+        idVermelho = totalCores;
+    }
+    return totalCores++;
+}
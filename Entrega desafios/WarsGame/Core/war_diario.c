@@ -0,0 +1,360 @@
+// NÚCLEO DO JOGO DE GUERRA - DIÁRIO DE ALTERAÇÕES E RAMOS DO MAPA
+//
+// OBJETIVO:
+// Permitir desfazer/refazer jogadas e avaliar jogadas hipotéticas sem
+// copiar o mapa inteiro:
+// - DiarioAlteracoes guarda o antes/depois apenas dos territórios tocados;
+//   desfazer, refazer e voltar a uma marca custam O(territórios alterados)
+// - MapaRamificado divide o mapa em blocos compartilhados entre ramos, com
+//   cópia de um bloco só na primeira escrita de cada ramo
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "war_core.h"
+
+// ============================================================================
+// FUNÇÃO: iniciarDiario
+// DESCRIÇÃO: Prepara um diário vazio
+// PARÂMETROS: diario (diário a preparar)
+//             capacidade (alterações reservadas de início)
+//             arena (orçamento da partida: o diário não cresce e, cheio,
+//             esquece as jogadas mais antigas; NULL: malloc, o diário cresce)
+// RETORNO: 0 em caso de sucesso, 1 em caso de falha de alocação
+// ============================================================================
+int iniciarDiario(DiarioAlteracoes *diario, int capacidade, ArenaPartida *arena)
+{
+    memset(diario, 0, sizeof(DiarioAlteracoes));
+    if (capacidade < 1)
+    {
+        capacidade = 1;
+    }
+
+    diario->arena = arena;
+    diario->alteracoes = (AlteracaoTerritorio *)alocarDe(arena, capacidade * sizeof(AlteracaoTerritorio));
+    if (diario->alteracoes == NULL)
+    {
+        return 1;
+    }
+
+    diario->capacidade = capacidade;
+    return 0;
+}
+
+// ============================================================================
+// FUNÇÃO: esquecerJogadaAntiga
+// DESCRIÇÃO: Abre espaço em um diário de tamanho fixo descartando a jogada
+//            concluída mais antiga (ela deixa de poder ser desfeita). As
+//            posições das alterações mudam, então marcas antigas deixam de valer.
+// PARÂMETROS: diario
+// RETORNO: 0 em caso de sucesso, 1 se não houver jogada concluída
+// ============================================================================
+static int esquecerJogadaAntiga(DiarioAlteracoes *diario)
+{
+    if (diario->concluidas == 0)
+    {
+        return 1;
+    }
+
+    int fim = 1;
+    while (fim < diario->concluidas && !diario->alteracoes[fim].inicioJogada)
+    {
+        fim++;
+    }
+
+    memmove(diario->alteracoes, diario->alteracoes + fim,
+            (diario->aplicadas - fim) * sizeof(AlteracaoTerritorio));
+    diario->aplicadas -= fim;
+    diario->concluidas -= fim;
+    diario->total = diario->aplicadas;
+    return 0;
+}
+
+// ============================================================================
+// FUNÇÃO: anotarAlteracao
+// DESCRIÇÃO: Guarda o estado de um território ANTES de ele ser alterado.
+//            A primeira anotação depois de concluirAlteracoes() abre uma
+//            nova jogada e descarta as jogadas desfeitas (não há mais refazer)
+// PARÂMETROS: diario, mapa (estado atual), id (território que vai mudar)
+// RETORNO: 0 em caso de sucesso, 1 em caso de falha de alocação (ou
+//          jogada maior que um diário de tamanho fixo)
+// ============================================================================
+int anotarAlteracao(DiarioAlteracoes *diario, const Territorio *mapa, int id)
+{
+    diario->total = diario->aplicadas;
+
+    // Na arena o diário não cresce: a jogada mais antiga dá lugar à nova
+    if (diario->aplicadas == diario->capacidade && diario->arena != NULL &&
+        esquecerJogadaAntiga(diario) != 0)
+    {
+        return 1;
+    }
+
+    if (diario->aplicadas == diario->capacidade)
+    {
+        int novaCapacidade = diario->capacidade * 2;
+        AlteracaoTerritorio *novas = (AlteracaoTerritorio *)realloc(
+            diario->alteracoes, novaCapacidade * sizeof(AlteracaoTerritorio));
+        if (novas == NULL)
+        {
+            return 1;
+        }
+        diario->alteracoes = novas;
+        diario->capacidade = novaCapacidade;
+    }
+
+    AlteracaoTerritorio *alteracao = &diario->alteracoes[diario->aplicadas];
+    alteracao->id = id;
+    alteracao->inicioJogada = (diario->concluidas == diario->aplicadas);
+    alteracao->donoAntes = mapa[id].dono;
+    alteracao->tropasAntes = mapa[id].tropas;
+
+    diario->aplicadas++;
+    diario->total = diario->aplicadas;
+    return 0;
+}
+
+// ============================================================================
+// FUNÇÃO: concluirAlteracoes
+// DESCRIÇÃO: Fecha a jogada aberta, guardando o estado DEPOIS de cada
+//            território anotado (usado para refazer)
+// PARÂMETROS: diario, mapa (estado depois da jogada)
+// ============================================================================
+void concluirAlteracoes(DiarioAlteracoes *diario, const Territorio *mapa)
+{
+    for (int i = diario->concluidas; i < diario->aplicadas; i++)
+    {
+        AlteracaoTerritorio *alteracao = &diario->alteracoes[i];
+        alteracao->donoDepois = mapa[alteracao->id].dono;
+        alteracao->tropasDepois = mapa[alteracao->id].tropas;
+    }
+    diario->concluidas = diario->aplicadas;
+}
+
+// ============================================================================
+// FUNÇÃO: atacarComDiario
+// DESCRIÇÃO: Resolve um ataque (sem mensagens) registrando-o como uma jogada
+// PARÂMETROS: diario, mapa, idAtacante / idDefensor (territórios do ataque)
+// RETORNO: desfecho do ataque (ATAQUE_SEM_TROPAS se o diário não tiver memória)
+// ============================================================================
+ResultadoAtaque atacarComDiario(DiarioAlteracoes *diario, Territorio *mapa, int idAtacante, int idDefensor)
+{
+    if (anotarAlteracao(diario, mapa, idAtacante) != 0 ||
+        anotarAlteracao(diario, mapa, idDefensor) != 0)
+    {
+        ResultadoAtaque falha = {ATAQUE_SEM_TROPAS, 0, 0, 0};
+        reverterAteMarca(diario, mapa, diario->concluidas);
+        return falha;
+    }
+
+    ResultadoAtaque resultado = resolverAtaque(&mapa[idAtacante], &mapa[idDefensor]);
+    concluirAlteracoes(diario, mapa);
+    return resultado;
+}
+
+// ============================================================================
+// FUNÇÃO: desfazerJogada
+// DESCRIÇÃO: Restaura o mapa para antes da última jogada aplicada
+// PARÂMETROS: diario, mapa
+// RETORNO: quantidade de territórios restaurados (0 se não há o que desfazer)
+// ============================================================================
+int desfazerJogada(DiarioAlteracoes *diario, Territorio *mapa)
+{
+    int restaurados = 0;
+
+    concluirAlteracoes(diario, mapa);
+    while (diario->aplicadas > 0)
+    {
+        AlteracaoTerritorio *alteracao = &diario->alteracoes[--diario->aplicadas];
+        mapa[alteracao->id].dono = alteracao->donoAntes;
+        mapa[alteracao->id].tropas = alteracao->tropasAntes;
+        restaurados++;
+
+        if (alteracao->inicioJogada)
+        {
+            break;
+        }
+    }
+
+    diario->concluidas = diario->aplicadas;
+    return restaurados;
+}
+
+// ============================================================================
+// FUNÇÃO: refazerJogada
+// DESCRIÇÃO: Aplica de novo a jogada desfeita mais recente
+// PARÂMETROS: diario, mapa
+// RETORNO: quantidade de territórios alterados (0 se não há o que refazer)
+// ============================================================================
+int refazerJogada(DiarioAlteracoes *diario, Territorio *mapa)
+{
+    int alterados = 0;
+
+    while (diario->aplicadas < diario->total)
+    {
+        AlteracaoTerritorio *alteracao = &diario->alteracoes[diario->aplicadas];
+        if (alterados > 0 && alteracao->inicioJogada)
+        {
+            break;
+        }
+
+        mapa[alteracao->id].dono = alteracao->donoDepois;
+        mapa[alteracao->id].tropas = alteracao->tropasDepois;
+        diario->aplicadas++;
+        alterados++;
+    }
+
+    diario->concluidas = diario->aplicadas;
+    return alterados;
+}
+
+// ============================================================================
+// FUNÇÃO: reverterAteMarca
+// DESCRIÇÃO: Desfaz tudo o que foi anotado depois da marca e esquece essas
+//            alterações. A marca é o valor de diario->aplicadas no momento
+//            em que a jogada hipotética começou.
+// PARÂMETROS: diario, mapa, marca
+// ============================================================================
+void reverterAteMarca(DiarioAlteracoes *diario, Territorio *mapa, int marca)
+{
+    while (diario->aplicadas > marca)
+    {
+        AlteracaoTerritorio *alteracao = &diario->alteracoes[--diario->aplicadas];
+        mapa[alteracao->id].dono = alteracao->donoAntes;
+        mapa[alteracao->id].tropas = alteracao->tropasAntes;
+    }
+
+    diario->total = diario->aplicadas;
+    diario->concluidas = diario->aplicadas;
+}
+
+// ============================================================================
+// FUNÇÃO: liberarDiario
+// DESCRIÇÃO: Libera a memória do diário
+// PARÂMETROS: diario
+// ============================================================================
+void liberarDiario(DiarioAlteracoes *diario)
+{
+    liberarDe(diario->arena, diario->alteracoes);
+    memset(diario, 0, sizeof(DiarioAlteracoes));
+}
+
+// ============================================================================
+// FUNÇÃO: criarRamo
+// DESCRIÇÃO: Copia um mapa comum para blocos compartilháveis
+// PARÂMETROS: ramo (saída), mapa (territórios), quantidade
+// RETORNO: 0 em caso de sucesso, 1 em caso de falha de alocação
+// ============================================================================
+int criarRamo(MapaRamificado *ramo, const Territorio *mapa, int quantidade)
+{
+    ramo->quantidadeTerritorios = quantidade;
+    ramo->quantidadeBlocos = (quantidade + TERRITORIOS_POR_BLOCO - 1) / TERRITORIOS_POR_BLOCO;
+    ramo->blocos = (BlocoTerritorios **)calloc(ramo->quantidadeBlocos, sizeof(BlocoTerritorios *));
+    if (ramo->blocos == NULL)
+    {
+        return 1;
+    }
+
+    for (int b = 0; b < ramo->quantidadeBlocos; b++)
+    {
+        ramo->blocos[b] = (BlocoTerritorios *)calloc(1, sizeof(BlocoTerritorios));
+        if (ramo->blocos[b] == NULL)
+        {
+            liberarRamo(ramo);
+            return 1;
+        }
+
+        int inicio = b * TERRITORIOS_POR_BLOCO;
+        int quantos = quantidade - inicio < TERRITORIOS_POR_BLOCO ? quantidade - inicio : TERRITORIOS_POR_BLOCO;
+        memcpy(ramo->blocos[b]->territorios, &mapa[inicio], quantos * sizeof(Territorio));
+        ramo->blocos[b]->referencias = 1;
+    }
+
+    return 0;
+}
+
+// ============================================================================
+// FUNÇÃO: ramificar
+// DESCRIÇÃO: Cria um ramo que compartilha todos os blocos da origem. Custa
+//            um ponteiro por bloco, não uma cópia dos territórios.
+// PARÂMETROS: destino (novo ramo), origem (ramo existente)
+// RETORNO: 0 em caso de sucesso, 1 em caso de falha de alocação
+// ============================================================================
+int ramificar(MapaRamificado *destino, const MapaRamificado *origem)
+{
+    destino->blocos = (BlocoTerritorios **)malloc(origem->quantidadeBlocos * sizeof(BlocoTerritorios *));
+    if (destino->blocos == NULL)
+    {
+        return 1;
+    }
+
+    destino->quantidadeBlocos = origem->quantidadeBlocos;
+    destino->quantidadeTerritorios = origem->quantidadeTerritorios;
+    for (int b = 0; b < origem->quantidadeBlocos; b++)
+    {
+        destino->blocos[b] = origem->blocos[b];
+        destino->blocos[b]->referencias++;
+    }
+
+    return 0;
+}
+
+// ============================================================================
+// FUNÇÃO: territorioRamo
+// DESCRIÇÃO: Acesso somente leitura a um território do ramo
+// PARÂMETROS: ramo, id
+// RETORNO: ponteiro para o território (não deve ser alterado)
+// ============================================================================
+const Territorio *territorioRamo(const MapaRamificado *ramo, int id)
+{
+    return &ramo->blocos[id / TERRITORIOS_POR_BLOCO]->territorios[id % TERRITORIOS_POR_BLOCO];
+}
+
+// ============================================================================
+// FUNÇÃO: alterarRamo
+// DESCRIÇÃO: Acesso de escrita a um território do ramo. Se o bloco ainda é
+//            compartilhado com outro ramo, ele é copiado antes.
+// PARÂMETROS: ramo, id
+// RETORNO: ponteiro para o território, ou NULL em caso de falha de alocação
+// ============================================================================
+Territorio *alterarRamo(MapaRamificado *ramo, int id)
+{
+    BlocoTerritorios **bloco = &ramo->blocos[id / TERRITORIOS_POR_BLOCO];
+
+    if ((*bloco)->referencias > 1)
+    {
+        BlocoTerritorios *copia = (BlocoTerritorios *)malloc(sizeof(BlocoTerritorios));
+        if (copia == NULL)
+        {
+            return NULL;
+        }
+        memcpy(copia, *bloco, sizeof(BlocoTerritorios));
+        copia->referencias = 1;
+        (*bloco)->referencias--;
+        *bloco = copia;
+    }
+
+    return &(*bloco)->territorios[id % TERRITORIOS_POR_BLOCO];
+}
+
+// ============================================================================
+// FUNÇÃO: liberarRamo
+// DESCRIÇÃO: Solta os blocos do ramo, liberando os que ninguém mais usa
+// PARÂMETROS: ramo
+// ============================================================================
+void liberarRamo(MapaRamificado *ramo)
+{
+    if (ramo->blocos != NULL)
+    {
+        for (int b = 0; b < ramo->quantidadeBlocos; b++)
+        {
+            if (ramo->blocos[b] != NULL && --ramo->blocos[b]->referencias == 0)
+            {
+                free(ramo->blocos[b]);
+            }
+        }
+        free(ramo->blocos);
+    }
+
+    memset(ramo, 0, sizeof(MapaRamificado));
+}
@@ -0,0 +1,489 @@
+// NÚCLEO DO JOGO DE GUERRA - ESCALONADOR DE PARTIDAS CONCORRENTES
+//
+// OBJETIVO:
+// Intercalar milhares de partidas em uma única thread. Cada partida é uma
+// estrutura Partida que pode ser suspensa e retomada: o escalonador retoma
+// a partida cujo próximo jogador fica pronto mais cedo, joga um turno e a
+// devolve à fila com o instante da jogada seguinte. Bots respondem na hora
+// e humanos (simulados) levam segundos, então partidas paradas não ocupam
+// nenhuma thread, apenas a sua estrutura.
+//
+// O relógio é virtual (milissegundos): um servidor real dormiria até o
+// próximo instante da fila ou até chegar a jogada de um humano.
+//
+// Cada partida fixa a versão das regras ao ser criada e a usa até o fim;
+// com um arquivo de regras, o escalonador confere o arquivo entre os turnos
+// e publica a versão nova sem parar nenhuma partida (ver war_regras.c).
+//
+// Com limites de uma categoria (ver war_limites.c), partidas grandes demais
+// são recusadas antes de alocar o mapa e um turno que passa do limite de
+// CPU adia a próxima jogada da partida, sem atrasar as outras.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+
+#include "war_core.h"
+
+#define INTERVALO_RECARGA_REGRAS 1024 // Turnos entre duas conferências do arquivo de regras
+#define TURNOS_NO_RASTRO 6 // Turnos da partida 0 exibidos, para ver a partida suspensa e retomada
+
+// ============================================================================
+// FUNÇÃO: memoriaPartida
+// DESCRIÇÃO: Memória de uma partida do escalonador: a estrutura (que guarda
+//            as missões) e o mapa
+// PARÂMETROS: quantidadeTerritorios
+// RETORNO: bytes, conferidos com o limite da categoria
+// ============================================================================
+size_t memoriaPartida(int quantidadeTerritorios)
+{
+    return sizeof(Partida) + (size_t)quantidadeTerritorios * sizeof(Territorio);
+}
+
+// ============================================================================
+// FUNÇÃO: criarPartida
+// DESCRIÇÃO: Prepara uma partida suspensa, pronta para o primeiro turno
+// PARÂMETROS: partida (estrutura a preencher)
+//             semente (define mapa, missões, atrasos e dados da partida)
+//             quantidadeTerritorios / quantidadeJogadores (tamanho do jogo)
+//             percentualHumanos (chance de cada jogador ser humano e lento)
+//             limites (da categoria da partida, ou NULL)
+// RETORNO: 0 em caso de sucesso, 1 em caso de falha de alocação, 2 se a
+//          partida passa do limite de memória da categoria
+// ============================================================================
+int criarPartida(Partida *partida, unsigned long long semente, int quantidadeTerritorios,
+                 int quantidadeJogadores, int percentualHumanos, const LimitesPartida *limites)
+{
+    memset(partida, 0, sizeof(Partida));
+    if (conferirMemoria(limites, memoriaPartida(quantidadeTerritorios)) != 0)
+    {
+        return 2;
+    }
+    partida->limites = limites;
+    partida->consumo.memoriaBytes = memoriaPartida(quantidadeTerritorios);
+    partida->quantidadeTerritorios = quantidadeTerritorios;
+    partida->quantidadeJogadores = quantidadeJogadores;
+    partida->vencedor = -1;
+    partida->regras = fixarRegras();
+
+    partida->mapa = (Territorio *)calloc(quantidadeTerritorios, sizeof(Territorio));
+    if (partida->mapa == NULL)
+    {
+        liberarPartida(partida);
+        return 1;
+    }
+
+    const RegrasJogo *regrasDaThread = regras;
+    usarRegras(partida->regras);
+    semearAleatorio(semente);
+    gerarMapaAleatorio(partida->mapa, quantidadeTerritorios, quantidadeJogadores);
+
+    // Missões sorteadas sem repetição, com o gerador da própria partida
+    SorteioMissoes sorteio;
+    iniciarSorteioMissoes(&sorteio, quantidadeTerritorios);
+    for (int i = 0; i < quantidadeJogadores; i++)
+    {
+        partida->donoJogador[i] = idCor(coresSimulacao[i]);
+        partida->missoes[i] = sortearMissao(&sorteio, NULL, partida->mapa, quantidadeTerritorios,
+                                            partida->donoJogador[i]);
+
+        // Humanos levam de 2 a 30 segundos para jogar; bots, 1 ms
+        if ((int)(proximoAleatorio() % 100) < percentualHumanos)
+        {
+            partida->atrasoJogador[i] = 2000 + (int)(proximoAleatorio() % 28001);
+        }
+        else
+        {
+            partida->atrasoJogador[i] = 1;
+        }
+    }
+
+    partida->acordarEm = partida->atrasoJogador[0];
+    partida->estadoAleatorio = salvarAleatorio();
+    usarRegras(regrasDaThread);
+    return 0;
+}
+
+// ============================================================================
+// FUNÇÃO: escolherJogada
+// DESCRIÇÃO: Escolha de um bot simples, sem atacar: sorteia um território
+//            próprio com tropas e um inimigo; passa a vez se não encontrar
+//            os dois em TENTATIVAS_JOGADA sorteios
+// PARÂMETROS: mapa / quantidade (territórios), donoJogador (ID da cor do bot)
+//             idDefensor (saída: território a atacar, -1 se passou a vez)
+// RETORNO: território atacante, ou -1 se o bot passou a vez
+// ============================================================================
+int escolherJogada(const Territorio *mapa, int quantidade, int donoJogador, int *idDefensor)
+{
+    int idAtacante = -1;
+    *idDefensor = -1;
+
+    for (int tentativa = 0; tentativa < TENTATIVAS_JOGADA && idAtacante < 0; tentativa++)
+    {
+        int id = (int)(proximoAleatorio() % quantidade);
+        if (mapa[id].dono == donoJogador && mapa[id].tropas > 0)
+        {
+            idAtacante = id;
+        }
+    }
+    for (int tentativa = 0; tentativa < TENTATIVAS_JOGADA && idAtacante >= 0 && *idDefensor < 0; tentativa++)
+    {
+        int id = (int)(proximoAleatorio() % quantidade);
+        if (mapa[id].dono != donoJogador)
+        {
+            *idDefensor = id;
+        }
+    }
+
+    if (idAtacante < 0 || *idDefensor < 0)
+    {
+        *idDefensor = -1;
+        return -1;
+    }
+    return idAtacante;
+}
+
+// ============================================================================
+// FUNÇÃO: jogadaAleatoria
+// DESCRIÇÃO: Jogada de um bot simples: escolhe (escolherJogada) e ataca
+// PARÂMETROS: mapa / quantidade (territórios), donoJogador (ID da cor do bot)
+//             idDefensor (saída: território atacado, -1 se passou a vez)
+// RETORNO: território atacante, ou -1 se o bot passou a vez
+// ============================================================================
+int jogadaAleatoria(Territorio *mapa, int quantidade, int donoJogador, int *idDefensor)
+{
+    int idAtacante = escolherJogada(mapa, quantidade, donoJogador, idDefensor);
+    if (idAtacante >= 0)
+    {
+        resolverAtaque(&mapa[idAtacante], &mapa[*idDefensor]);
+    }
+    return idAtacante;
+}
+
+// ============================================================================
+// FUNÇÃO: jogarTurno
+// DESCRIÇÃO: Retoma a partida (gerador e regras fixadas), faz a jogada do
+//            jogador da vez e suspende a partida de novo. Com limites, a CPU
+//            do turno é medida e um turno caro adia a próxima jogada.
+// PARÂMETROS: partida (partida a retomar)
+// RETORNO: 1 se a partida terminou, 0 se deve voltar para a fila
+// ============================================================================
+int jogarTurno(Partida *partida)
+{
+    int idDefensor;
+    const RegrasJogo *regrasDaThread = regras;
+    long long inicioCpu = (partida->limites != NULL) ? cpuThreadNs() : 0;
+
+    usarRegras(partida->regras);
+    restaurarAleatorio(partida->estadoAleatorio);
+
+    jogadaAleatoria(partida->mapa, partida->quantidadeTerritorios,
+                    partida->donoJogador[partida->jogadorDaVez], &idDefensor);
+    partida->turnos++;
+
+    partida->vencedor = verificarVencedor(partida->missoes, partida->donoJogador, partida->mapa,
+                                          partida->quantidadeJogadores, partida->quantidadeTerritorios);
+
+    // Suspende: passa a vez e agenda a próxima jogada
+    partida->jogadorDaVez = (partida->jogadorDaVez + 1) % partida->quantidadeJogadores;
+    partida->acordarEm += partida->atrasoJogador[partida->jogadorDaVez];
+    partida->estadoAleatorio = salvarAleatorio();
+    usarRegras(regrasDaThread);
+
+    if (partida->limites != NULL)
+    {
+        partida->acordarEm += registrarCpuTurno(&partida->consumo, partida->limites,
+                                                cpuThreadNs() - inicioCpu);
+    }
+
+    return partida->vencedor != -1 || partida->turnos >= MAX_TURNOS_SIMULACAO;
+}
+
+// ============================================================================
+// FUNÇÃO: liberarPartida
+// DESCRIÇÃO: Libera o mapa de uma partida e solta a versão das regras (as
+//            missões são IDs guardados na própria partida)
+// PARÂMETROS: partida (partida a liberar)
+// ============================================================================
+void liberarPartida(Partida *partida)
+{
+    free(partida->mapa);
+    partida->mapa = NULL;
+    soltarRegras(partida->regras);
+    partida->regras = NULL;
+}
+
+// ============================================================================
+// FUNÇÃO: conferirArquivoRegras
+// DESCRIÇÃO: Publica o arquivo de regras se ele mudou desde a última
+//            conferência (data e tamanho, lidos antes do conteúdo). Um
+//            arquivo inválido não é publicado: as partidas novas continuam
+//            na versão atual.
+// PARÂMETROS: caminho, assinatura (data e tamanho vistos, atualizados)
+//             turnos (para a mensagem)
+// RETORNO: 0 se publicou ou nada mudou, 1 se o arquivo não pôde ser usado
+// ============================================================================
+static int conferirArquivoRegras(const char *caminho, long long assinatura[2], long long turnos)
+{
+    struct stat info;
+    if (stat(caminho, &info) != 0)
+    {
+        // Sem data e tamanho, a assinatura é zerada: o arquivo que voltar é
+        // lido de novo, e o aviso sai só na primeira conferência que falhar
+        if (assinatura[0] != 0 || assinatura[1] != 0)
+        {
+            printf("⚠️ %s não pôde ser lido: as partidas novas continuam na versão %u\n",
+                   caminho, versaoPublicada());
+        }
+        assinatura[0] = 0;
+        assinatura[1] = 0;
+        return 1;
+    }
+    if ((long long)info.st_mtime == assinatura[0] && (long long)info.st_size == assinatura[1])
+    {
+        return 0;
+    }
+    assinatura[0] = (long long)info.st_mtime;
+    assinatura[1] = (long long)info.st_size;
+
+    int linhaErro;
+    if (recarregarRegras(caminho, &linhaErro) != 0)
+    {
+        printf("⚠️ %s não pôde ser usado (linha %d): as partidas novas continuam na versão %u\n",
+               caminho, linhaErro, versaoPublicada());
+        return 1;
+    }
+    printf("🔄 Regras de %s publicadas no turno %lld: versão %u\n", caminho, turnos, versaoPublicada());
+    return 0;
+}
+
+// ============================================================================
+// FUNÇÃO: vemAntes
+// DESCRIÇÃO: Ordem da fila do escalonador: menor instante de despertar e,
+//            em empate, menor índice (mantém a execução reproduzível)
+// ============================================================================
+static int vemAntes(const Partida *partidas, int a, int b)
+{
+    return partidas[a].acordarEm < partidas[b].acordarEm ||
+           (partidas[a].acordarEm == partidas[b].acordarEm && a < b);
+}
+
+// ============================================================================
+// FUNÇÃO: descerNaFila
+// DESCRIÇÃO: Restaura a ordem do heap mínimo a partir da posição informada
+// PARÂMETROS: fila (índices das partidas), tamanho, posicao, partidas
+// ============================================================================
+static void descerNaFila(int *fila, int tamanho, int posicao, const Partida *partidas)
+{
+    while (1)
+    {
+        int menor = posicao;
+        int esquerda = 2 * posicao + 1;
+        int direita = esquerda + 1;
+
+        if (esquerda < tamanho && vemAntes(partidas, fila[esquerda], fila[menor]))
+        {
+            menor = esquerda;
+        }
+        if (direita < tamanho && vemAntes(partidas, fila[direita], fila[menor]))
+        {
+            menor = direita;
+        }
+        if (menor == posicao)
+        {
+            return;
+        }
+
+        int troca = fila[posicao];
+        fila[posicao] = fila[menor];
+        fila[menor] = troca;
+        posicao = menor;
+    }
+}
+
+// ============================================================================
+// FUNÇÃO: executarPartidas
+// DESCRIÇÃO: Cria várias partidas e as intercala em uma única thread até
+//            todas terminarem, exibindo um resumo da execução e as
+//            estatísticas das batalhas de todas as partidas. Com arquivo de
+//            regras, metade das partidas começa logo e cada uma que termina
+//            dá a vaga para a próxima, que fixa as regras publicadas então.
+// PARÂMETROS: semente (a partida i usa semente + i)
+//             quantidadeJogos (partidas simultâneas, ou no total com regras)
+//             quantidadeTerritorios / quantidadeJogadores (tamanho de cada jogo)
+//             percentualHumanos (chance de cada jogador ser humano e lento)
+//             arquivoRegras (publicado no início e conferido durante a
+//             execução; ou NULL)
+//             limites (categoria das partidas, ou NULL)
+// RETORNO: 0 em caso de sucesso, 1 em caso de falha de alocação, 2 se o
+//          arquivo de regras não pôde ser usado, 3 se as partidas passam do
+//          limite de memória da categoria
+// ============================================================================
+int executarPartidas(unsigned long long semente, int quantidadeJogos, int quantidadeTerritorios,
+                     int quantidadeJogadores, int percentualHumanos, const char *arquivoRegras,
+                     const LimitesPartida *limites)
+{
+    // Todas as partidas têm o mesmo tamanho: recusa antes de alocar qualquer uma
+    if (conferirMemoria(limites, memoriaPartida(quantidadeTerritorios)) != 0)
+    {
+        printf("❌ Partidas de %d territórios usam %.1f MB: passam do limite da categoria %s (%.1f MB)!\n",
+               quantidadeTerritorios, memoriaPartida(quantidadeTerritorios) / 1048576.0,
+               limites->categoria, limites->memoriaMaxima / 1048576.0);
+        return 3;
+    }
+
+    Partida *partidas = (Partida *)calloc(quantidadeJogos, sizeof(Partida));
+    int *fila = (int *)malloc(quantidadeJogos * sizeof(int));
+    EstatisticasBatalhas *estatisticas = (EstatisticasBatalhas *)calloc(1, sizeof(EstatisticasBatalhas));
+    if (partidas == NULL || fila == NULL || estatisticas == NULL)
+    {
+        free(partidas);
+        free(fila);
+        free(estatisticas);
+        return 1;
+    }
+
+    // As primeiras partidas já fixam as regras do arquivo
+    long long assinaturaRegras[2] = {-1, -1};
+    if (arquivoRegras != NULL && conferirArquivoRegras(arquivoRegras, assinaturaRegras, 0) != 0)
+    {
+        free(partidas);
+        free(fila);
+        free(estatisticas);
+        return 2;
+    }
+
+    int simultaneas = (arquivoRegras != NULL) ? (quantidadeJogos + 1) / 2 : quantidadeJogos;
+    for (int i = 0; i < simultaneas; i++)
+    {
+        if (criarPartida(&partidas[i], semente + (unsigned long long)i, quantidadeTerritorios,
+                         quantidadeJogadores, percentualHumanos, limites) != 0)
+        {
+            for (int j = 0; j < i; j++)
+            {
+                liberarPartida(&partidas[j]);
+            }
+            free(partidas);
+            free(fila);
+            free(estatisticas);
+            return 1;
+        }
+        partidas[i].numero = i;
+        fila[i] = i;
+    }
+
+    for (int i = simultaneas / 2 - 1; i >= 0; i--)
+    {
+        descerNaFila(fila, simultaneas, i, partidas);
+    }
+
+    long long turnosTotais = 0;
+    long long instante = 0;
+    int vitorias = 0;
+    int terminadasEmVersaoAntiga = 0;
+    ConsumoPartida consumo = {0};
+    int emAndamento = simultaneas;
+    int proxima = simultaneas;
+    int ultimaJogada = -1;      // Vaga da partida que jogou o turno anterior
+    long long retomadas = 0;    // Turnos que retomaram uma partida suspensa enquanto outra jogava
+    int maiorSuspensas = 0;     // Partidas esperando na fila enquanto uma joga
+    int rastreando = 1;         // Ainda exibindo os turnos da partida 0
+    long long turnoDoRastro = 0;
+    double inicio = agoraSegundos();
+    estatisticasBatalhas = estatisticas;
+
+    while (emAndamento > 0)
+    {
+        // Retoma a partida que acorda mais cedo
+        Partida *partida = &partidas[fila[0]];
+        instante = partida->acordarEm;
+        retomadas += (fila[0] != ultimaJogada && ultimaJogada >= 0);
+        ultimaJogada = fila[0];
+        if (emAndamento - 1 > maiorSuspensas)
+        {
+            maiorSuspensas = emAndamento - 1;
+        }
+
+        marcarPartidaEstatisticas(estatisticas, partida->numero, partida->mapa, partida->quantidadeTerritorios);
+        int terminou = jogarTurno(partida);
+        turnosTotais++;
+
+        // Rastro da primeira partida: entre dois turnos dela, outras jogam
+        if (partida == &partidas[0] && rastreando)
+        {
+            printf("⏱️  %9.3f s: partida 0 joga o turno %d, depois de %lld turnos de outras partidas\n",
+                   instante / 1000.0, partida->turnos, turnosTotais - 1 - turnoDoRastro);
+            turnoDoRastro = turnosTotais;
+            rastreando = !terminou && partida->turnos < TURNOS_NO_RASTRO;
+        }
+
+        if (terminou)
+        {
+            vitorias += (partida->vencedor >= 0);
+            terminadasEmVersaoAntiga += (partida->regras->versao < versaoPublicada());
+            juntarConsumo(&consumo, &partida->consumo);
+            liberarPartida(partida);
+
+            if (proxima < quantidadeJogos)
+            {
+                // A vaga passa para a próxima partida, com as regras publicadas agora
+                if (criarPartida(partida, semente + (unsigned long long)proxima, quantidadeTerritorios,
+                                 quantidadeJogadores, percentualHumanos, limites) != 0)
+                {
+                    for (int i = 0; i < emAndamento; i++)
+                    {
+                        liberarPartida(&partidas[fila[i]]);
+                    }
+                    estatisticasBatalhas = NULL;
+                    free(partidas);
+                    free(fila);
+                    free(estatisticas);
+                    return 1;
+                }
+                partida->acordarEm += instante;
+                partida->numero = proxima++;
+            }
+            else
+            {
+                fila[0] = fila[--emAndamento];
+            }
+        }
+        descerNaFila(fila, emAndamento, 0, partidas);
+
+        // Entre dois turnos, nunca durante um: a recarga não para nenhuma partida
+        if (arquivoRegras != NULL && turnosTotais % INTERVALO_RECARGA_REGRAS == 0)
+        {
+            conferirArquivoRegras(arquivoRegras, assinaturaRegras, turnosTotais);
+        }
+    }
+    double duracao = agoraSegundos() - inicio;
+    estatisticasBatalhas = NULL;
+
+    printf("Partidas: %d (%d com vencedor)\n", quantidadeJogos, vitorias);
+    printf("Turnos jogados: %lld (%.1f por partida)\n", turnosTotais,
+           quantidadeJogos > 0 ? (double)turnosTotais / quantidadeJogos : 0.0);
+    printf("Retomadas: %lld (%.1f%% dos turnos retomaram uma partida suspensa) | até %d partidas suspensas ao mesmo tempo\n",
+           retomadas, turnosTotais > 0 ? 100.0 * retomadas / turnosTotais : 0.0, maiorSuspensas);
+    printf("Tempo virtual até a última partida: %.1f s\n", instante / 1000.0);
+    printf("Tempo real: %.3f s (%.0f turnos/s em uma thread)\n",
+           duracao, duracao > 0.0 ? turnosTotais / duracao : 0.0);
+    printf("Memória por partida suspensa: ~%zu bytes\n", memoriaPartida(quantidadeTerritorios));
+    if (arquivoRegras != NULL)
+    {
+        printf("Regras: versão %u publicada | %d partidas terminaram na versão fixada antes de uma recarga\n",
+               versaoPublicada(), terminadasEmVersaoAntiga);
+    }
+    if (limites != NULL)
+    {
+        printf("Limites (%s): CPU de %.3f s em %lld turnos, maior turno %.3f ms | %lld turnos freados (%.1f s de espera)\n",
+               limites->categoria, consumo.cpuTotalNs / 1e9, consumo.turnosMedidos,
+               consumo.cpuMaiorTurnoNs / 1e6, consumo.turnosFreados, consumo.esperaFreioMs / 1000.0);
+    }
+    exibirEstatisticas(estatisticas);
+
+    free(partidas);
+    free(fila);
+    free(estatisticas);
+    return 0;
+}
@@ -0,0 +1,581 @@
+// NÚCLEO DO JOGO DE GUERRA - ESTATÍSTICAS CONTÍNUAS DAS BATALHAS
+//
+// OBJETIVO:
+// Acompanhar partidas longas sem guardar cada batalha: frequência das faces
+// do dado por jogador, taxa de conquista, territórios mais disputados e
+// quantis das tropas em batalha. Tudo ocupa memória fixa e pode ser juntado
+// (juntarEstatisticas) entre threads e partidas.
+//
+// resolverAtaque() alimenta as estatísticas apontadas por
+// estatisticasBatalhas; com o ponteiro nulo (padrão) nada é registrado.
+
+#include <limits.h>
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "war_core.h"
+
+_Thread_local EstatisticasBatalhas *estatisticasBatalhas = NULL;
+
+#define SUBFAIXAS (1 << BITS_SUBFAIXA)
+
+// ============================================================================
+// FUNÇÃO: faixaHistograma
+// DESCRIÇÃO: Índice da faixa do HistogramaLog que recebe um valor
+// PARÂMETROS: valor
+// RETORNO: índice entre 0 e TOTAL_FAIXAS_LOG - 1
+// ============================================================================
+static int faixaHistograma(unsigned long long valor)
+{
+    if (valor < 2 * SUBFAIXAS)
+    {
+        return (int)valor;
+    }
+
+    int expoente = 63 - __builtin_clzll(valor);
+    int subfaixa = (int)((valor >> (expoente - BITS_SUBFAIXA)) & (SUBFAIXAS - 1));
+    return (expoente - BITS_SUBFAIXA + 1) * SUBFAIXAS + subfaixa;
+}
+
+// ============================================================================
+// FUNÇÃO: registrarValorHistograma
+// DESCRIÇÃO: Acrescenta um valor ao histograma
+// PARÂMETROS: histograma, valor
+// ============================================================================
+void registrarValorHistograma(HistogramaLog *histograma, unsigned long long valor)
+{
+    histograma->faixas[faixaHistograma(valor)]++;
+    histograma->total++;
+    histograma->soma += (double)valor;
+    if (valor > histograma->maior)
+    {
+        histograma->maior = valor;
+    }
+}
+
+// ============================================================================
+// FUNÇÃO: quantilHistograma
+// DESCRIÇÃO: Estima um quantil (ponto médio da faixa onde ele cai)
+// PARÂMETROS: histograma, quantil (0.0 a 1.0; ex.: 0.99 para o p99)
+// RETORNO: valor estimado (0 se o histograma estiver vazio)
+// ============================================================================
+unsigned long long quantilHistograma(const HistogramaLog *histograma, double quantil)
+{
+    if (histograma->total == 0)
+    {
+        return 0;
+    }
+
+    // Posição (a partir de 1) do valor procurado na ordem crescente
+    double alvo = quantil * (double)histograma->total;
+    unsigned long long posicao = (unsigned long long)alvo;
+    if (posicao < alvo || posicao < 1)
+    {
+        posicao++;
+    }
+
+    unsigned long long acumulado = 0;
+    for (int faixa = 0; faixa < TOTAL_FAIXAS_LOG; faixa++)
+    {
+        acumulado += histograma->faixas[faixa];
+        if (acumulado >= posicao)
+        {
+            if (faixa < 2 * SUBFAIXAS)
+            {
+                return (unsigned long long)faixa;
+            }
+
+            int expoente = faixa / SUBFAIXAS + BITS_SUBFAIXA - 1;
+            unsigned long long largura = 1ULL << (expoente - BITS_SUBFAIXA);
+            unsigned long long inicio = (unsigned long long)(SUBFAIXAS + faixa % SUBFAIXAS) * largura;
+            unsigned long long meio = inicio + largura / 2;
+            return meio < histograma->maior ? meio : histograma->maior;
+        }
+    }
+    return histograma->maior;
+}
+
+// ============================================================================
+// FUNÇÃO: juntarHistogramas
+// DESCRIÇÃO: Soma o histograma de origem ao de destino
+// PARÂMETROS: destino, origem
+// ============================================================================
+void juntarHistogramas(HistogramaLog *destino, const HistogramaLog *origem)
+{
+    for (int faixa = 0; faixa < TOTAL_FAIXAS_LOG; faixa++)
+    {
+        destino->faixas[faixa] += origem->faixas[faixa];
+    }
+    destino->total += origem->total;
+    destino->soma += origem->soma;
+    if (origem->maior > destino->maior)
+    {
+        destino->maior = origem->maior;
+    }
+}
+
+// ============================================================================
+// FUNÇÃO: posicaoDisputa
+// DESCRIÇÃO: Posição da chave (partida, território) na tabela de contadores:
+//            a que guarda a chave ou a posição livre onde ela entraria
+//            (hash de Fibonacci dos dois IDs e sondagem linear; a tabela tem
+//            o dobro de posições que contadores, então nunca enche)
+// PARÂMETROS: estatisticas, partida / territorio (chave)
+// RETORNO: posição entre 0 e 2 * TOTAL_DISPUTADOS - 1
+// ============================================================================
+static int posicaoDisputa(const EstatisticasBatalhas *estatisticas, int partida, int territorio)
+{
+    unsigned long long chave = ((unsigned long long)(unsigned int)partida << 32) | (unsigned int)territorio;
+    int mascara = 2 * TOTAL_DISPUTADOS - 1;
+    int posicao = (int)((chave * 0x9E3779B97F4A7C15ULL) >> (64 - BITS_DISPUTADOS - 1));
+    for (; estatisticas->tabelaDisputados[posicao] != 0; posicao = (posicao + 1) & mascara)
+    {
+        const TerritorioDisputado *contador = &estatisticas->disputados[estatisticas->tabelaDisputados[posicao] - 1];
+        if (contador->partida == partida && contador->territorio == territorio)
+        {
+            break;
+        }
+    }
+    return posicao;
+}
+
+// ============================================================================
+// FUNÇÃO: removerDisputa
+// DESCRIÇÃO: Tira uma chave da tabela de contadores, trazendo para trás as
+//            que vinham depois dela na sondagem (sem marcas de removido)
+// PARÂMETROS: estatisticas, posicao (ocupada)
+// ============================================================================
+static void removerDisputa(EstatisticasBatalhas *estatisticas, int posicao)
+{
+    int mascara = 2 * TOTAL_DISPUTADOS - 1;
+    estatisticas->tabelaDisputados[posicao] = 0;
+    for (int seguinte = (posicao + 1) & mascara; estatisticas->tabelaDisputados[seguinte] != 0;
+         seguinte = (seguinte + 1) & mascara)
+    {
+        int contador = estatisticas->tabelaDisputados[seguinte] - 1;
+        estatisticas->tabelaDisputados[seguinte] = 0;
+        int destino = posicaoDisputa(estatisticas, estatisticas->disputados[contador].partida,
+                                     estatisticas->disputados[contador].territorio);
+        estatisticas->tabelaDisputados[destino] = contador + 1;
+    }
+}
+
+// ============================================================================
+// FUNÇÃO: menorContagem
+// DESCRIÇÃO: Menor contagem entre os contadores em uso (0 se não há nenhum)
+// ============================================================================
+static unsigned long long menorContagem(const EstatisticasBatalhas *estatisticas)
+{
+    unsigned long long menor = estatisticas->totalDisputados > 0 ? ULLONG_MAX : 0;
+    for (int i = 0; i < estatisticas->totalDisputados; i++)
+    {
+        if (estatisticas->disputados[i].ataques < menor)
+        {
+            menor = estatisticas->disputados[i].ataques;
+        }
+    }
+    return menor;
+}
+
+// ============================================================================
+// FUNÇÃO: menosAtacado
+// DESCRIÇÃO: Um contador com a menor contagem. Segue do cursor procurando
+//            menorDisputado; se não há mais nenhum adiante, recalcula o
+//            menor e volta ao começo. Como as contagens só crescem, o cursor
+//            dá no máximo duas voltas por valor do mínimo.
+// PARÂMETROS: estatisticas (com todos os contadores em uso)
+// RETORNO: índice do contador
+// ============================================================================
+static int menosAtacado(EstatisticasBatalhas *estatisticas)
+{
+    for (;;)
+    {
+        for (; estatisticas->cursorDisputados < estatisticas->totalDisputados; estatisticas->cursorDisputados++)
+        {
+            if (estatisticas->disputados[estatisticas->cursorDisputados].ataques == estatisticas->menorDisputado)
+            {
+                return estatisticas->cursorDisputados;
+            }
+        }
+        estatisticas->menorDisputado = menorContagem(estatisticas);
+        estatisticas->cursorDisputados = 0;
+    }
+}
+
+// ============================================================================
+// FUNÇÃO: contarDisputa
+// DESCRIÇÃO: Passo do SpaceSaving: soma "ataques" ao território; se ele não
+//            está no resumo e não há contador livre, ocupa o lugar do menos
+//            atacado, herdando a contagem dele como erro
+// PARÂMETROS: estatisticas, partida / territorio (chave), nome, ataques, erro
+// ============================================================================
+static void contarDisputa(EstatisticasBatalhas *estatisticas, int partida, int territorio,
+                          const char *nome, unsigned long long ataques, unsigned long long erro)
+{
+    int posicao = posicaoDisputa(estatisticas, partida, territorio);
+    if (estatisticas->tabelaDisputados[posicao] != 0)
+    {
+        TerritorioDisputado *disputado = &estatisticas->disputados[estatisticas->tabelaDisputados[posicao] - 1];
+        disputado->ataques += ataques;
+        disputado->erro += erro;
+        return;
+    }
+
+    int contador;
+    TerritorioDisputado *disputado;
+    if (estatisticas->totalDisputados < TOTAL_DISPUTADOS)
+    {
+        contador = estatisticas->totalDisputados++;
+        disputado = &estatisticas->disputados[contador];
+        disputado->ataques = ataques;
+        disputado->erro = erro;
+        // Um contador novo pode ter menos que o mínimo guardado
+        estatisticas->menorDisputado = 0;
+        estatisticas->cursorDisputados = 0;
+    }
+    else
+    {
+        contador = menosAtacado(estatisticas);
+        disputado = &estatisticas->disputados[contador];
+        removerDisputa(estatisticas, posicaoDisputa(estatisticas, disputado->partida, disputado->territorio));
+        posicao = posicaoDisputa(estatisticas, partida, territorio);
+        disputado->erro = disputado->ataques + erro;
+        disputado->ataques += ataques;
+    }
+
+    disputado->partida = partida;
+    disputado->territorio = territorio;
+    strncpy(disputado->nome, nome, MAX_NOME - 1);
+    disputado->nome[MAX_NOME - 1] = '\0';
+    estatisticas->tabelaDisputados[posicao] = contador + 1;
+}
+
+// ============================================================================
+// FUNÇÃO: marcarPartidaEstatisticas
+// DESCRIÇÃO: Informa de que partida são as próximas batalhas: a chave de um
+//            território disputado é (partida, ID), com o ID tirado da posição
+//            do defensor no mapa. Batalhas fora desse mapa não entram nos
+//            territórios disputados (as demais estatísticas valem sempre).
+// PARÂMETROS: estatisticas, partida (número que a identifica), mapa / quantidade
+// ============================================================================
+void marcarPartidaEstatisticas(EstatisticasBatalhas *estatisticas, int partida, const Territorio *mapa,
+                               int quantidade)
+{
+    estatisticas->partidaAtual = partida;
+    estatisticas->mapaAtual = mapa;
+    estatisticas->territoriosAtual = quantidade;
+}
+
+// ============================================================================
+// FUNÇÃO: registrarBatalha
+// DESCRIÇÃO: Registra uma batalha (chamada por resolverAtaque antes de
+//            aplicar o resultado, com os donos ainda originais)
+// PARÂMETROS: estatisticas, atacante / defensor (territórios)
+//             dadoAtacante / dadoDefensor (faces tiradas)
+// ============================================================================
+void registrarBatalha(EstatisticasBatalhas *estatisticas, const Territorio *atacante,
+                      const Territorio *defensor, int dadoAtacante, int dadoDefensor)
+{
+    int donoAtacante = atacante->dono;
+    int donoDefensor = defensor->dono;
+
+    if (donoAtacante >= 0)
+    {
+        estatisticas->ataques[donoAtacante]++;
+        estatisticas->conquistas[donoAtacante] += (dadoAtacante > dadoDefensor);
+        if (dadoAtacante >= 1 && dadoAtacante <= MAX_FACES_ESTATISTICA)
+        {
+            estatisticas->dados[donoAtacante][dadoAtacante - 1]++;
+        }
+    }
+    if (donoDefensor >= 0 && dadoDefensor >= 1 && dadoDefensor <= MAX_FACES_ESTATISTICA)
+    {
+        estatisticas->dados[donoDefensor][dadoDefensor - 1]++;
+    }
+
+    const Territorio *mapa = estatisticas->mapaAtual;
+    if (mapa != NULL && defensor >= mapa && defensor < mapa + estatisticas->territoriosAtual)
+    {
+        contarDisputa(estatisticas, estatisticas->partidaAtual, (int)(defensor - mapa), defensor->nome, 1, 0);
+    }
+    registrarValorHistograma(&estatisticas->tropas, (unsigned long long)(atacante->tropas > 0 ? atacante->tropas : 0));
+    registrarValorHistograma(&estatisticas->tropas, (unsigned long long)(defensor->tropas > 0 ? defensor->tropas : 0));
+}
+
+// ============================================================================
+// FUNÇÃO: juntarEstatisticas
+// DESCRIÇÃO: Acrescenta as estatísticas de origem às de destino (de outra
+//            thread ou partida). Os IDs de cor precisam ser os mesmos nos dois
+//            lados, o que vale dentro de um mesmo processo.
+// PARÂMETROS: destino, origem
+// ============================================================================
+void juntarEstatisticas(EstatisticasBatalhas *destino, const EstatisticasBatalhas *origem)
+{
+    for (int jogador = 0; jogador < MAX_CORES; jogador++)
+    {
+        for (int face = 0; face < MAX_FACES_ESTATISTICA; face++)
+        {
+            destino->dados[jogador][face] += origem->dados[jogador][face];
+        }
+        destino->ataques[jogador] += origem->ataques[jogador];
+        destino->conquistas[jogador] += origem->conquistas[jogador];
+    }
+
+    // SpaceSaving: quem falta em um dos resumos pode ter até o menor
+    // contador daquele resumo (se ele estiver cheio)
+    unsigned long long menorDestino = (destino->totalDisputados == TOTAL_DISPUTADOS) ? menorContagem(destino) : 0;
+    unsigned long long menorOrigem = (origem->totalDisputados == TOTAL_DISPUTADOS) ? menorContagem(origem) : 0;
+
+    for (int i = 0; i < destino->totalDisputados; i++)
+    {
+        TerritorioDisputado *disputado = &destino->disputados[i];
+        int contador = origem->tabelaDisputados[posicaoDisputa(origem, disputado->partida, disputado->territorio)] - 1;
+        disputado->ataques += (contador >= 0) ? origem->disputados[contador].ataques : menorOrigem;
+        disputado->erro += (contador >= 0) ? origem->disputados[contador].erro : menorOrigem;
+    }
+    destino->menorDisputado = 0;
+    destino->cursorDisputados = 0;
+
+    // Os que só a origem tem entram se passarem do menos atacado do destino
+    for (int j = 0; j < origem->totalDisputados; j++)
+    {
+        TerritorioDisputado novo = origem->disputados[j];
+        if (destino->tabelaDisputados[posicaoDisputa(destino, novo.partida, novo.territorio)] != 0)
+        {
+            continue;
+        }
+
+        novo.ataques += menorDestino;
+        novo.erro += menorDestino;
+        if (destino->totalDisputados < TOTAL_DISPUTADOS)
+        {
+            contarDisputa(destino, novo.partida, novo.territorio, novo.nome, novo.ataques, novo.erro);
+            continue;
+        }
+
+        int contador = menosAtacado(destino);
+        TerritorioDisputado *substituido = &destino->disputados[contador];
+        if (novo.ataques > substituido->ataques)
+        {
+            removerDisputa(destino, posicaoDisputa(destino, substituido->partida, substituido->territorio));
+            *substituido = novo;
+            destino->tabelaDisputados[posicaoDisputa(destino, novo.partida, novo.territorio)] = contador + 1;
+        }
+    }
+
+    juntarHistogramas(&destino->tropas, &origem->tropas);
+}
+
+// ============================================================================
+// FUNÇÃO: quiQuadradoDados
+// DESCRIÇÃO: Estatística qui-quadrado das faces tiradas por um jogador,
+//            comparadas com um dado honesto
+// PARÂMETROS: estatisticas, jogador (ID da cor), faces (faces do dado)
+// RETORNO: valor do qui-quadrado (0 se o jogador não lançou dados)
+// ============================================================================
+double quiQuadradoDados(const EstatisticasBatalhas *estatisticas, int jogador, int faces)
+{
+    unsigned long long lancamentos = 0;
+    for (int face = 0; face < faces; face++)
+    {
+        lancamentos += estatisticas->dados[jogador][face];
+    }
+    if (lancamentos == 0)
+    {
+        return 0.0;
+    }
+
+    double esperado = (double)lancamentos / faces;
+    double quiQuadrado = 0.0;
+    for (int face = 0; face < faces; face++)
+    {
+        double diferenca = (double)estatisticas->dados[jogador][face] - esperado;
+        quiQuadrado += diferenca * diferenca / esperado;
+    }
+    return quiQuadrado;
+}
+
+// ============================================================================
+// FUNÇÃO: limiteQuiQuadrado
+// DESCRIÇÃO: Valor do qui-quadrado que um dado honesto só ultrapassa em
+//            0,1% das vezes (aproximação de Wilson-Hilferty)
+// PARÂMETROS: grausLiberdade (faces - 1)
+// RETORNO: limite acima do qual o dado é considerado suspeito
+// ============================================================================
+double limiteQuiQuadrado(int grausLiberdade)
+{
+    const double z = 3.090; // Quantil 99,9% da normal padrão
+    double termo = 2.0 / (9.0 * grausLiberdade);
+    double base = 1.0 - termo + z * sqrt(termo);
+    return grausLiberdade * base * base * base;
+}
+
+// ============================================================================
+// FUNÇÃO: maisDisputados
+// DESCRIÇÃO: Copia os DISPUTADOS_EXIBIDOS contadores mais atacados, do mais
+//            para o menos atacado. Cada passo pega o maior abaixo do anterior
+//            na ordem (ataques decrescentes, posição crescente): são poucos
+//            passos e nenhuma cópia dos contadores.
+// PARÂMETROS: estatisticas, saida (DISPUTADOS_EXIBIDOS posições)
+// RETORNO: quantidade copiada
+// ============================================================================
+static int maisDisputados(const EstatisticasBatalhas *estatisticas, TerritorioDisputado *saida)
+{
+    int anterior = -1;
+    int quantidade = 0;
+    for (; quantidade < DISPUTADOS_EXIBIDOS && quantidade < estatisticas->totalDisputados; quantidade++)
+    {
+        int maior = -1;
+        for (int i = 0; i < estatisticas->totalDisputados; i++)
+        {
+            unsigned long long ataques = estatisticas->disputados[i].ataques;
+            int depoisDoAnterior = anterior < 0 || ataques < estatisticas->disputados[anterior].ataques ||
+                                   (ataques == estatisticas->disputados[anterior].ataques && i > anterior);
+            if (depoisDoAnterior && (maior < 0 || ataques > estatisticas->disputados[maior].ataques))
+            {
+                maior = i;
+            }
+        }
+        saida[quantidade] = estatisticas->disputados[maior];
+        anterior = maior;
+    }
+    return quantidade;
+}
+
+// ============================================================================
+// FUNÇÃO: exibirEstatisticas
+// DESCRIÇÃO: Exibe o resumo das estatísticas das batalhas
+// PARÂMETROS: estatisticas
+// ============================================================================
+void exibirEstatisticas(const EstatisticasBatalhas *estatisticas)
+{
+    int faces = regras->facesDado < MAX_FACES_ESTATISTICA ? regras->facesDado : MAX_FACES_ESTATISTICA;
+    double limite = limiteQuiQuadrado(faces - 1);
+
+    printf("\n%-12s %12s %12s %8s %12s\n", "Jogador", "Ataques", "Conquistas", "Taxa", "Qui² dados");
+    for (int jogador = 0; jogador < totalCores; jogador++)
+    {
+        unsigned long long lancamentos = 0;
+        for (int face = 0; face < faces; face++)
+        {
+            lancamentos += estatisticas->dados[jogador][face];
+        }
+        if (lancamentos == 0)
+        {
+            continue;
+        }
+
+        double quiQuadrado = quiQuadradoDados(estatisticas, jogador, faces);
+        printf("%-12s %12llu %12llu %7.1f%% %9.1f %s\n", tabelaCores[jogador],
+               estatisticas->ataques[jogador], estatisticas->conquistas[jogador],
+               estatisticas->ataques[jogador] > 0
+                   ? 100.0 * estatisticas->conquistas[jogador] / estatisticas->ataques[jogador]
+                   : 0.0,
+               quiQuadrado, quiQuadrado > limite ? "⚠️" : "✅");
+    }
+    printf("(qui² acima de %.1f indica dado viciado com 99,9%% de confiança)\n", limite);
+
+    TerritorioDisputado exibidos[DISPUTADOS_EXIBIDOS];
+    int quantidade = maisDisputados(estatisticas, exibidos);
+    printf("\nTerritórios mais disputados (%d contadores, %d em uso):\n", TOTAL_DISPUTADOS,
+           estatisticas->totalDisputados);
+    for (int i = 0; i < quantidade; i++)
+    {
+        printf("  partida %-8d %-30s %8llu ataques (erro até %llu)\n", exibidos[i].partida, exibidos[i].nome,
+               exibidos[i].ataques, exibidos[i].erro);
+    }
+
+    printf("\nTropas em batalha: p50 %llu | p90 %llu | p99 %llu | máximo %llu\n",
+           quantilHistograma(&estatisticas->tropas, 0.50), quantilHistograma(&estatisticas->tropas, 0.90),
+           quantilHistograma(&estatisticas->tropas, 0.99), estatisticas->tropas.maior);
+}
+
+// ============================================================================
+// FUNÇÃO: escreverRotulo
+// DESCRIÇÃO: Escreve o valor de um rótulo do Prometheus, escapando aspas,
+//            barras invertidas e quebras de linha digitadas nos nomes
+// PARÂMETROS: arquivo, texto
+// ============================================================================
+static void escreverRotulo(FILE *arquivo, const char *texto)
+{
+    for (; *texto != '\0'; texto++)
+    {
+        if (*texto == '"' || *texto == '\\')
+        {
+            fputc('\\', arquivo);
+            fputc(*texto, arquivo);
+        }
+        else if (*texto == '\n')
+        {
+            fputs("\\n", arquivo);
+        }
+        else
+        {
+            fputc(*texto, arquivo);
+        }
+    }
+}
+
+// ============================================================================
+// FUNÇÃO: exportarEstatisticas
+// DESCRIÇÃO: Acrescenta as estatísticas ao arquivo de métricas no formato
+//            texto do Prometheus
+// PARÂMETROS: arquivo (aberto para escrita), estatisticas
+// ============================================================================
+void exportarEstatisticas(FILE *arquivo, const EstatisticasBatalhas *estatisticas)
+{
+    int faces = regras->facesDado < MAX_FACES_ESTATISTICA ? regras->facesDado : MAX_FACES_ESTATISTICA;
+    const double quantis[] = {0.5, 0.9, 0.99};
+
+    fprintf(arquivo, "# HELP war_dados_total Faces tiradas por jogador.\n");
+    fprintf(arquivo, "# TYPE war_dados_total counter\n");
+    for (int jogador = 0; jogador < totalCores; jogador++)
+    {
+        for (int face = 0; face < faces; face++)
+        {
+            fprintf(arquivo, "war_dados_total{jogador=\"");
+            escreverRotulo(arquivo, tabelaCores[jogador]);
+            fprintf(arquivo, "\",face=\"%d\"} %llu\n", face + 1, estatisticas->dados[jogador][face]);
+        }
+    }
+
+    fprintf(arquivo, "# HELP war_ataques_jogador_total Ataques feitos por jogador.\n");
+    fprintf(arquivo, "# TYPE war_ataques_jogador_total counter\n");
+    for (int jogador = 0; jogador < totalCores; jogador++)
+    {
+        fprintf(arquivo, "war_ataques_jogador_total{jogador=\"");
+        escreverRotulo(arquivo, tabelaCores[jogador]);
+        fprintf(arquivo, "\"} %llu\n", estatisticas->ataques[jogador]);
+    }
+
+    fprintf(arquivo, "# HELP war_conquistas_jogador_total Conquistas por jogador.\n");
+    fprintf(arquivo, "# TYPE war_conquistas_jogador_total counter\n");
+    for (int jogador = 0; jogador < totalCores; jogador++)
+    {
+        fprintf(arquivo, "war_conquistas_jogador_total{jogador=\"");
+        escreverRotulo(arquivo, tabelaCores[jogador]);
+        fprintf(arquivo, "\"} %llu\n", estatisticas->conquistas[jogador]);
+    }
+
+    fprintf(arquivo, "# HELP war_territorio_disputado Ataques recebidos pelos territórios mais disputados.\n");
+    fprintf(arquivo, "# TYPE war_territorio_disputado gauge\n");
+    TerritorioDisputado exportados[DISPUTADOS_EXIBIDOS];
+    int quantidade = maisDisputados(estatisticas, exportados);
+    for (int i = 0; i < quantidade; i++)
+    {
+        fprintf(arquivo, "war_territorio_disputado{partida=\"%d\",territorio=\"", exportados[i].partida);
+        escreverRotulo(arquivo, exportados[i].nome);
+        fprintf(arquivo, "\"} %llu\n", exportados[i].ataques);
+    }
+
+    fprintf(arquivo, "# HELP war_tropas_batalha Tropas de atacante e defensor em cada batalha.\n");
+    fprintf(arquivo, "# TYPE war_tropas_batalha summary\n");
+    for (int i = 0; i < 3; i++)
+    {
+        fprintf(arquivo, "war_tropas_batalha{quantile=\"%g\"} %llu\n",
+                quantis[i], quantilHistograma(&estatisticas->tropas, quantis[i]));
+    }
+    fprintf(arquivo, "war_tropas_batalha_sum %.0f\n", estatisticas->tropas.soma);
+    fprintf(arquivo, "war_tropas_batalha_count %llu\n", estatisticas->tropas.total);
+}
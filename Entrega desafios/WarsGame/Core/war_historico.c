@@ -0,0 +1,675 @@
+// NÚCLEO DO JOGO DE GUERRA - HISTÓRICO COMPRIMIDO DO MAPA
+//
+// OBJETIVO:
+// Guardar o dono e as tropas de todos os territórios em cada turno, sem
+// guardar um mapa por turno:
+// - a cada intervaloQuadros turnos, um quadro completo do mapa
+// - entre dois quadros, só as mudanças de cada turno, com os mesmos varints
+//   e zigzag do fluxo de deltas (um ataque costuma mudar dois territórios)
+// O mapa de um turno qualquer é o quadro anterior mais, no máximo,
+// intervaloQuadros turnos de mudanças, e as séries por jogador (territórios
+// e tropas ao longo da partida) saem de uma única passada pelas mudanças.
+// Quando a memória passa do limite os trechos mais antigos são descartados.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "war_core.h"
+
+#define MAX_BYTES_MUDANCA 15      // ID, dono e variação de tropas: 3 varints
+#define CONFERENCIAS_HISTORICO 64 // Turnos sorteados e conferidos pela medição
+#define REFORCO_HISTORICO 3       // Tropas que o jogador da vez recebe na medição
+#define CONSULTAS_HISTORICO 10000 // Consultas sorteadas pela medição
+#define PONTOS_SERIE 10           // Linhas da série exibida pela medição
+
+// ============================================================================
+// FUNÇÃO: zigzag / desfazerZigzag
+// DESCRIÇÃO: 0, -1, 1, -2, 2... viram 0, 1, 2, 3, 4... (e o contrário)
+// ============================================================================
+static unsigned int zigzag(int valor)
+{
+    return ((unsigned int)valor << 1) ^ (unsigned int)(valor >> 31);
+}
+
+static int desfazerZigzag(unsigned int valor)
+{
+    return (int)(valor >> 1) ^ -(int)(valor & 1);
+}
+
+// ============================================================================
+// FUNÇÃO: reservarTrecho
+// DESCRIÇÃO: Garante espaço para mais bytes no trecho (dobra a capacidade)
+// PARÂMETROS: historico (conta os bytes alocados), trecho, extra
+// RETORNO: 0 em caso de sucesso, 1 em caso de falha de alocação
+// ============================================================================
+static int reservarTrecho(HistoricoMapa *historico, TrechoHistorico *trecho, size_t extra)
+{
+    if (trecho->tamanho + extra <= trecho->capacidade)
+    {
+        return 0;
+    }
+
+    size_t capacidade = (trecho->capacidade > 0) ? trecho->capacidade : 256;
+    while (capacidade < trecho->tamanho + extra)
+    {
+        capacidade *= 2;
+    }
+
+    unsigned char *dados = (unsigned char *)realloc(trecho->dados, capacidade);
+    if (dados == NULL)
+    {
+        return 1;
+    }
+    historico->bytes += capacidade - trecho->capacidade;
+    trecho->dados = dados;
+    trecho->capacidade = capacidade;
+    return 0;
+}
+
+// ============================================================================
+// FUNÇÃO: abrirTrecho
+// DESCRIÇÃO: Começa um trecho com o quadro completo do estado atual. O
+//            trecho anterior está completo e é reduzido ao tamanho usado.
+// PARÂMETROS: historico
+// RETORNO: 0 em caso de sucesso, 1 em caso de falha de alocação
+// ============================================================================
+static int abrirTrecho(HistoricoMapa *historico)
+{
+    if (historico->quantidadeTrechos == historico->capacidadeTrechos)
+    {
+        int capacidade = (historico->capacidadeTrechos > 0) ? historico->capacidadeTrechos * 2 : 16;
+        TrechoHistorico *trechos = (TrechoHistorico *)realloc(historico->trechos,
+                                                              capacidade * sizeof(TrechoHistorico));
+        if (trechos == NULL)
+        {
+            return 1;
+        }
+        historico->trechos = trechos;
+        historico->capacidadeTrechos = capacidade;
+    }
+
+    if (historico->quantidadeTrechos > 0)
+    {
+        TrechoHistorico *anterior = &historico->trechos[historico->quantidadeTrechos - 1];
+        unsigned char *dados = (unsigned char *)realloc(anterior->dados, anterior->tamanho);
+        if (dados != NULL)
+        {
+            historico->bytes -= anterior->capacidade - anterior->tamanho;
+            anterior->dados = dados;
+            anterior->capacidade = anterior->tamanho;
+        }
+    }
+
+    TrechoHistorico *trecho = &historico->trechos[historico->quantidadeTrechos];
+    memset(trecho, 0, sizeof(TrechoHistorico));
+    if (reservarTrecho(historico, trecho, (size_t)historico->quantidadeTerritorios * 10))
+    {
+        return 1;
+    }
+
+    for (int id = 0; id < historico->quantidadeTerritorios; id++)
+    {
+        trecho->tamanho += escreverVarint(trecho->dados + trecho->tamanho, (unsigned int)historico->donos[id]);
+        trecho->tamanho += escreverVarint(trecho->dados + trecho->tamanho, (unsigned int)historico->tropas[id]);
+    }
+    trecho->inicioMudancas = trecho->tamanho;
+    historico->quantidadeTrechos++;
+    return 0;
+}
+
+// ============================================================================
+// FUNÇÃO: descartarTrechosAntigos
+// DESCRIÇÃO: Libera os trechos mais antigos enquanto a memória passar do
+//            limite (o trecho atual nunca é descartado)
+// PARÂMETROS: historico
+// ============================================================================
+static void descartarTrechosAntigos(HistoricoMapa *historico)
+{
+    int descartados = 0;
+    while (historico->bytes > historico->limiteBytes &&
+           historico->quantidadeTrechos - descartados > 1)
+    {
+        historico->bytes -= historico->trechos[descartados].capacidade;
+        free(historico->trechos[descartados].dados);
+        descartados++;
+    }
+
+    if (descartados > 0)
+    {
+        historico->quantidadeTrechos -= descartados;
+        historico->primeiroTrecho += descartados;
+        memmove(historico->trechos, historico->trechos + descartados,
+                historico->quantidadeTrechos * sizeof(TrechoHistorico));
+    }
+}
+
+// ============================================================================
+// FUNÇÃO: criarHistorico
+// DESCRIÇÃO: Cria o histórico com o mapa atual como turno 0
+// PARÂMETROS: historico, mapa / quantidadeTerritorios, quantidadeJogadores
+//             donoJogador (ID da cor de cada jogador, para as séries)
+//             intervaloQuadros (turnos entre quadros completos, >= 1)
+//             limiteBytes (memória máxima dos trechos)
+// RETORNO: 0 em caso de sucesso, 1 em caso de falha
+// ============================================================================
+int criarHistorico(HistoricoMapa *historico, const Territorio *mapa, int quantidadeTerritorios,
+                   int quantidadeJogadores, const int *donoJogador, int intervaloQuadros, size_t limiteBytes)
+{
+    memset(historico, 0, sizeof(HistoricoMapa));
+    if (quantidadeTerritorios < 1 || quantidadeJogadores < 1 ||
+        quantidadeJogadores > TOTAL_CORES_SIMULACAO || intervaloQuadros < 1)
+    {
+        return 1;
+    }
+
+    historico->quantidadeTerritorios = quantidadeTerritorios;
+    historico->quantidadeJogadores = quantidadeJogadores;
+    historico->intervaloQuadros = intervaloQuadros;
+    historico->limiteBytes = limiteBytes;
+    memcpy(historico->donoJogador, donoJogador, quantidadeJogadores * sizeof(int));
+
+    historico->donos = (int *)malloc(quantidadeTerritorios * sizeof(int));
+    historico->tropas = (int *)malloc(quantidadeTerritorios * sizeof(int));
+    if (historico->donos == NULL || historico->tropas == NULL)
+    {
+        liberarHistorico(historico);
+        return 1;
+    }
+
+    for (int id = 0; id < quantidadeTerritorios; id++)
+    {
+        historico->donos[id] = mapa[id].dono;
+        historico->tropas[id] = mapa[id].tropas;
+    }
+
+    if (abrirTrecho(historico) != 0)
+    {
+        liberarHistorico(historico);
+        return 1;
+    }
+    return 0;
+}
+
+// ============================================================================
+// FUNÇÃO: anotarMudanca
+// DESCRIÇÃO: Grava a mudança de um território, se houver (espaço reservado)
+// PARÂMETROS: historico, trecho (atual), mapa, id
+// ============================================================================
+static void anotarMudanca(HistoricoMapa *historico, TrechoHistorico *trecho, const Territorio *mapa, int id)
+{
+    int dono = mapa[id].dono;
+    int variacao = mapa[id].tropas - historico->tropas[id];
+    if (dono == historico->donos[id] && variacao == 0)
+    {
+        return;
+    }
+
+    unsigned char *destino = trecho->dados + trecho->tamanho;
+    int tamanho = escreverVarint(destino, (unsigned int)id + 1);
+    tamanho += escreverVarint(destino + tamanho,
+                              (dono != historico->donos[id]) ? (unsigned int)dono + 1 : 0);
+    tamanho += escreverVarint(destino + tamanho, zigzag(variacao));
+    trecho->tamanho += tamanho;
+
+    historico->donos[id] = dono;
+    historico->tropas[id] = mapa[id].tropas;
+}
+
+// ============================================================================
+// FUNÇÃO: registrarTurnoHistorico
+// DESCRIÇÃO: Grava as mudanças do mapa desde o turno anterior
+// PARÂMETROS: historico, mapa (estado depois do turno)
+//             ids / quantidadeIds (territórios que podem ter mudado, como os
+//             dois de um ataque; ids NULL compara o mapa inteiro)
+// RETORNO: 0 em caso de sucesso, 1 em caso de falha de alocação (o turno
+//          não é gravado)
+// ============================================================================
+int registrarTurnoHistorico(HistoricoMapa *historico, const Territorio *mapa, const int *ids, int quantidadeIds)
+{
+    TrechoHistorico *trecho = &historico->trechos[historico->quantidadeTrechos - 1];
+    int quantidade = historico->quantidadeTerritorios;
+
+    // Reserva antes de gravar, para nunca deixar um turno pela metade
+    size_t mudancas = 0;
+    if (ids == NULL)
+    {
+        for (int id = 0; id < quantidade; id++)
+        {
+            mudancas += mapa[id].dono != historico->donos[id] || mapa[id].tropas != historico->tropas[id];
+        }
+    }
+    else
+    {
+        mudancas = (size_t)quantidadeIds;
+    }
+    if (reservarTrecho(historico, trecho, mudancas * MAX_BYTES_MUDANCA + 1) != 0)
+    {
+        return 1;
+    }
+
+    if (ids == NULL)
+    {
+        for (int id = 0; id < quantidade && mudancas > 0; id++)
+        {
+            anotarMudanca(historico, trecho, mapa, id);
+        }
+    }
+    else
+    {
+        // IDs repetidos não mudam na segunda vez e não são gravados de novo
+        for (int i = 0; i < quantidadeIds; i++)
+        {
+            if (ids[i] >= 0 && ids[i] < quantidade)
+            {
+                anotarMudanca(historico, trecho, mapa, ids[i]);
+            }
+        }
+    }
+    trecho->dados[trecho->tamanho++] = 0;
+    historico->turnoAtual++;
+
+    if (historico->turnoAtual % historico->intervaloQuadros == 0)
+    {
+        if (abrirTrecho(historico) != 0)
+        {
+            // Sem o quadro, o turno não pode ser consultado: desfaz a gravação
+            historico->turnoAtual--;
+            return 1;
+        }
+        descartarTrechosAntigos(historico);
+    }
+    return 0;
+}
+
+// ============================================================================
+// FUNÇÃO: primeiroTurnoHistorico
+// DESCRIÇÃO: Turno mais antigo que ainda pode ser consultado
+// PARÂMETROS: historico
+// RETORNO: número do turno
+// ============================================================================
+int primeiroTurnoHistorico(const HistoricoMapa *historico)
+{
+    return historico->primeiroTrecho * historico->intervaloQuadros;
+}
+
+// ============================================================================
+// FUNÇÃO: aplicarTurnoGravado
+// DESCRIÇÃO: Aplica as mudanças de um turno gravado a um mapa e, se
+//            pedido, às contagens por jogador
+// PARÂMETROS: trecho, posicao (início das mudanças do turno; avança)
+//             mapa, jogadorDoDono (jogador de cada ID de cor, -1 se nenhum; ou NULL)
+//             territorios / tropas (contagens por jogador)
+// ============================================================================
+static void aplicarTurnoGravado(const TrechoHistorico *trecho, size_t *posicao, Territorio *mapa,
+                                const int *jogadorDoDono, int *territorios, long long *tropas)
+{
+    unsigned int id, dono, variacao;
+    while (lerVarintMemoria(trecho->dados, trecho->tamanho, posicao, &id) && id != 0)
+    {
+        lerVarintMemoria(trecho->dados, trecho->tamanho, posicao, &dono);
+        lerVarintMemoria(trecho->dados, trecho->tamanho, posicao, &variacao);
+        Territorio *territorio = &mapa[id - 1];
+
+        if (jogadorDoDono != NULL && territorio->dono >= 0 && territorio->dono < MAX_CORES &&
+            jogadorDoDono[territorio->dono] >= 0)
+        {
+            territorios[jogadorDoDono[territorio->dono]]--;
+            tropas[jogadorDoDono[territorio->dono]] -= territorio->tropas;
+        }
+
+        if (dono != 0)
+        {
+            territorio->dono = (int)dono - 1;
+        }
+        territorio->tropas += desfazerZigzag(variacao);
+
+        if (jogadorDoDono != NULL && territorio->dono >= 0 && territorio->dono < MAX_CORES &&
+            jogadorDoDono[territorio->dono] >= 0)
+        {
+            territorios[jogadorDoDono[territorio->dono]]++;
+            tropas[jogadorDoDono[territorio->dono]] += territorio->tropas;
+        }
+    }
+}
+
+// ============================================================================
+// FUNÇÃO: reconstruirTurno
+// DESCRIÇÃO: Monta o mapa de um turno: quadro do trecho e mudanças seguintes
+// PARÂMETROS: historico, turno (já validado), mapa (saída: dono e tropas)
+//             posicao (saída: onde começam as mudanças do turno seguinte)
+// ============================================================================
+static void reconstruirTurno(const HistoricoMapa *historico, int turno, Territorio *mapa, size_t *posicao)
+{
+    const TrechoHistorico *trecho =
+        &historico->trechos[turno / historico->intervaloQuadros - historico->primeiroTrecho];
+
+    *posicao = 0;
+    for (int id = 0; id < historico->quantidadeTerritorios; id++)
+    {
+        unsigned int dono, tropas;
+        lerVarintMemoria(trecho->dados, trecho->tamanho, posicao, &dono);
+        lerVarintMemoria(trecho->dados, trecho->tamanho, posicao, &tropas);
+        mapa[id].dono = (int)dono;
+        mapa[id].tropas = (int)tropas;
+    }
+
+    for (int t = turno % historico->intervaloQuadros; t > 0; t--)
+    {
+        aplicarTurnoGravado(trecho, posicao, mapa, NULL, NULL, NULL);
+    }
+}
+
+// ============================================================================
+// FUNÇÃO: consultarTurno
+// DESCRIÇÃO: Preenche dono e tropas do mapa como estavam em um turno
+// PARÂMETROS: historico, turno, mapa (nomes ficam como estão)
+// RETORNO: 0 em caso de sucesso, 1 se o turno não existe ou foi descartado
+// ============================================================================
+int consultarTurno(const HistoricoMapa *historico, int turno, Territorio *mapa)
+{
+    if (turno < primeiroTurnoHistorico(historico) || turno > historico->turnoAtual)
+    {
+        return 1;
+    }
+
+    size_t posicao;
+    reconstruirTurno(historico, turno, mapa, &posicao);
+    return 0;
+}
+
+// ============================================================================
+// FUNÇÃO: serieJogadores
+// DESCRIÇÃO: Territórios e tropas de cada jogador de passo em passo turnos,
+//            para gráficos: um quadro e depois só as mudanças
+// PARÂMETROS: historico, turnoInicial / turnoFinal, passo (>= 1)
+//             territorios / tropas (saída: ponto x quantidadeJogadores valores
+//             cada, com (turnoFinal - turnoInicial) / passo + 1 pontos)
+// RETORNO: quantidade de pontos, ou -1 se o intervalo não está disponível
+//          ou faltou memória
+// ============================================================================
+int serieJogadores(const HistoricoMapa *historico, int turnoInicial, int turnoFinal, int passo,
+                   int *territorios, long long *tropas)
+{
+    if (passo < 1 || turnoInicial < primeiroTurnoHistorico(historico) || turnoFinal < turnoInicial ||
+        turnoFinal > historico->turnoAtual)
+    {
+        return -1;
+    }
+
+    Territorio *mapa = (Territorio *)malloc(historico->quantidadeTerritorios * sizeof(Territorio));
+    if (mapa == NULL)
+    {
+        return -1;
+    }
+
+    int jogadorDoDono[MAX_CORES];
+    for (int c = 0; c < MAX_CORES; c++)
+    {
+        jogadorDoDono[c] = -1;
+    }
+    for (int j = 0; j < historico->quantidadeJogadores; j++)
+    {
+        jogadorDoDono[historico->donoJogador[j]] = j;
+    }
+
+    size_t posicao;
+    reconstruirTurno(historico, turnoInicial, mapa, &posicao);
+
+    int territoriosAtuais[TOTAL_CORES_SIMULACAO] = {0};
+    long long tropasAtuais[TOTAL_CORES_SIMULACAO] = {0};
+    for (int id = 0; id < historico->quantidadeTerritorios; id++)
+    {
+        int dono = mapa[id].dono;
+        if (dono >= 0 && dono < MAX_CORES && jogadorDoDono[dono] >= 0)
+        {
+            territoriosAtuais[jogadorDoDono[dono]]++;
+            tropasAtuais[jogadorDoDono[dono]] += mapa[id].tropas;
+        }
+    }
+
+    int jogadores = historico->quantidadeJogadores;
+    int ultimo = turnoInicial + (turnoFinal - turnoInicial) / passo * passo;
+    int pontos = 0;
+    int trechoAtual = turnoInicial / historico->intervaloQuadros;
+    for (int turno = turnoInicial;; turno++)
+    {
+        if ((turno - turnoInicial) % passo == 0)
+        {
+            memcpy(&territorios[pontos * jogadores], territoriosAtuais, jogadores * sizeof(int));
+            memcpy(&tropas[pontos * jogadores], tropasAtuais, jogadores * sizeof(long long));
+            pontos++;
+        }
+        if (turno == ultimo)
+        {
+            break;
+        }
+
+        // As mudanças do turno seguinte estão no trecho do turno atual
+        if (turno / historico->intervaloQuadros != trechoAtual)
+        {
+            trechoAtual = turno / historico->intervaloQuadros;
+            posicao = historico->trechos[trechoAtual - historico->primeiroTrecho].inicioMudancas;
+        }
+        aplicarTurnoGravado(&historico->trechos[trechoAtual - historico->primeiroTrecho], &posicao, mapa,
+                            jogadorDoDono, territoriosAtuais, tropasAtuais);
+    }
+
+    free(mapa);
+    return pontos;
+}
+
+// ============================================================================
+// FUNÇÃO: liberarHistorico
+// DESCRIÇÃO: Libera os trechos e o estado do histórico
+// PARÂMETROS: historico
+// ============================================================================
+void liberarHistorico(HistoricoMapa *historico)
+{
+    for (int i = 0; i < historico->quantidadeTrechos; i++)
+    {
+        free(historico->trechos[i].dados);
+    }
+    free(historico->trechos);
+    free(historico->donos);
+    free(historico->tropas);
+    memset(historico, 0, sizeof(HistoricoMapa));
+}
+
+// ============================================================================
+// FUNÇÃO: resumirMapa
+// DESCRIÇÃO: Hash de dono e tropas do mapa, para conferir as consultas
+// ============================================================================
+static unsigned long long resumirMapa(const Territorio *mapa, int quantidade)
+{
+    unsigned long long hash = FNV_BASE;
+    for (int id = 0; id < quantidade; id++)
+    {
+        hash = (hash ^ (unsigned int)mapa[id].dono) * FNV_PRIMO;
+        hash = (hash ^ (unsigned int)mapa[id].tropas) * FNV_PRIMO;
+    }
+    return hash;
+}
+
+// ============================================================================
+// FUNÇÃO: reforcarJogador
+// DESCRIÇÃO: Reforço do jogador da vez na medição: REFORCO_HISTORICO tropas
+//            em um território próprio sorteado (os ataques só tiram tropas;
+//            sem reforço o mapa para de mudar depois de alguns milhares de
+//            turnos e o histórico só grava turnos vazios)
+// PARÂMETROS: mapa / quantidade (territórios), donoJogador (ID da cor)
+// RETORNO: território reforçado, ou -1 se o jogador não tem nenhum
+// ============================================================================
+static int reforcarJogador(Territorio *mapa, int quantidade, int donoJogador)
+{
+    for (int tentativa = 0; tentativa < TENTATIVAS_JOGADA; tentativa++)
+    {
+        int id = (int)(proximoAleatorio() % quantidade);
+        if (mapa[id].dono == donoJogador)
+        {
+            mapa[id].tropas += REFORCO_HISTORICO;
+            return id;
+        }
+    }
+    return -1;
+}
+
+// ============================================================================
+// FUNÇÃO: medirHistorico
+// DESCRIÇÃO: Joga uma partida longa de bots (sem encerrar na vitória, com
+//            reforço a cada turno) gravando o histórico, e mede gravação,
+//            memória, consultas de turnos sorteados e a série por jogador.
+//            Turnos sorteados (em geral entre dois quadros) têm o mapa
+//            resumido durante a partida e são conferidos pelas consultas.
+// PARÂMETROS: semente, turnos, quantidadeTerritorios / quantidadeJogadores
+//             intervaloQuadros, limiteMegabytes (memória do histórico)
+// RETORNO: 0 se todas as consultas conferem, 1 caso contrário
+// ============================================================================
+int medirHistorico(unsigned long long semente, int turnos, int quantidadeTerritorios, int quantidadeJogadores,
+                   int intervaloQuadros, int limiteMegabytes)
+{
+    Territorio *mapa = (Territorio *)calloc(quantidadeTerritorios, sizeof(Territorio));
+    Territorio *consulta = (Territorio *)calloc(quantidadeTerritorios, sizeof(Territorio));
+    if (mapa == NULL || consulta == NULL)
+    {
+        printf("❌ Erro: Falha na alocação de memória para territórios!\n");
+        free(mapa);
+        free(consulta);
+        return 1;
+    }
+
+    int donoJogador[TOTAL_CORES_SIMULACAO];
+    semearAleatorio(semente);
+    gerarMapaAleatorio(mapa, quantidadeTerritorios, quantidadeJogadores);
+    for (int j = 0; j < quantidadeJogadores; j++)
+    {
+        donoJogador[j] = idCor(coresSimulacao[j]);
+    }
+
+    HistoricoMapa historico;
+    if (criarHistorico(&historico, mapa, quantidadeTerritorios, quantidadeJogadores, donoJogador,
+                       intervaloQuadros, (size_t)limiteMegabytes << 20) != 0)
+    {
+        printf("❌ Erro: Falha na alocação de memória para o histórico!\n");
+        free(mapa);
+        free(consulta);
+        return 1;
+    }
+
+    // Um turno sorteado em cada faixa de turnos/CONFERENCIAS_HISTORICO: a
+    // consulta precisa aplicar as mudanças depois do quadro, não só lê-lo
+    int turnosConferidos[CONFERENCIAS_HISTORICO];
+    unsigned long long resumos[CONFERENCIAS_HISTORICO];
+    int foraDosQuadros = 0;
+    for (int c = 0; c < CONFERENCIAS_HISTORICO; c++)
+    {
+        int inicioFaixa = (int)((long long)turnos * c / CONFERENCIAS_HISTORICO);
+        int fimFaixa = (int)((long long)turnos * (c + 1) / CONFERENCIAS_HISTORICO);
+        turnosConferidos[c] = (fimFaixa > inicioFaixa)
+                                  ? inicioFaixa + 1 + (int)(proximoAleatorio() % (unsigned int)(fimFaixa - inicioFaixa))
+                                  : (fimFaixa > 1 ? fimFaixa : 1); // Partida curta: o turno 0 não é resumido
+    }
+
+    int falhas = 0;
+    int proximaConferencia = 0;
+    double inicio = agoraSegundos();
+    for (int turno = 1; turno <= turnos && falhas == 0; turno++)
+    {
+        int ids[3];
+        int jogador = (turno - 1) % quantidadeJogadores;
+        ids[0] = reforcarJogador(mapa, quantidadeTerritorios, donoJogador[jogador]);
+        ids[1] = jogadaAleatoria(mapa, quantidadeTerritorios, donoJogador[jogador], &ids[2]);
+        falhas += registrarTurnoHistorico(&historico, mapa, ids, 3);
+
+        while (proximaConferencia < CONFERENCIAS_HISTORICO && turnosConferidos[proximaConferencia] == turno)
+        {
+            resumos[proximaConferencia++] = resumirMapa(mapa, quantidadeTerritorios);
+        }
+    }
+    double duracaoGravacao = agoraSegundos() - inicio;
+
+    if (falhas > 0)
+    {
+        printf("❌ Erro: Falha na alocação de memória para o histórico!\n");
+        liberarHistorico(&historico);
+        free(mapa);
+        free(consulta);
+        return 1;
+    }
+
+    // Consultas de turnos sorteados entre os que ainda estão guardados
+    int primeiro = primeiroTurnoHistorico(&historico);
+    int disponiveis = historico.turnoAtual - primeiro + 1;
+    unsigned long long conferencia = 0;
+    inicio = agoraSegundos();
+    for (int i = 0; i < CONSULTAS_HISTORICO; i++)
+    {
+        consultarTurno(&historico, primeiro + (int)(proximoAleatorio() % (unsigned int)disponiveis), consulta);
+        conferencia += (unsigned int)consulta[0].tropas;
+    }
+    double duracaoConsultas = agoraSegundos() - inicio;
+
+    int conferidos = 0;
+    for (int c = 0; c < CONFERENCIAS_HISTORICO; c++)
+    {
+        if (consultarTurno(&historico, turnosConferidos[c], consulta) == 0)
+        {
+            conferidos++;
+            foraDosQuadros += turnosConferidos[c] % intervaloQuadros != 0;
+            falhas += resumirMapa(consulta, quantidadeTerritorios) != resumos[c];
+        }
+    }
+    falhas += consultarTurno(&historico, historico.turnoAtual, consulta) != 0 ||
+              resumirMapa(consulta, quantidadeTerritorios) != resumirMapa(mapa, quantidadeTerritorios);
+
+    double bruto = (double)(turnos + 1) * quantidadeTerritorios * 2 * sizeof(int);
+    printf("Turnos: %d | Territórios: %d | Jogadores: %d | Quadro a cada %d turnos\n",
+           turnos, quantidadeTerritorios, quantidadeJogadores, intervaloQuadros);
+    printf("Gravação: %.1f ns por turno\n", duracaoGravacao * 1e9 / turnos);
+    printf("Memória: %.2f MB (limite %d MB) | Um mapa por turno: %.2f MB\n",
+           historico.bytes / 1048576.0, limiteMegabytes, bruto / 1048576.0);
+    printf("Turnos guardados: %d a %d (%.2f bytes por turno)\n", primeiro, historico.turnoAtual,
+           (double)historico.bytes / disponiveis);
+    printf("Consulta de um turno: %.2f us (conferência %llu)\n",
+           duracaoConsultas * 1e6 / CONSULTAS_HISTORICO, conferencia);
+    printf("Turnos conferidos: %d de %d, %d entre dois quadros (os demais foram descartados) | Divergências: %d\n",
+           conferidos + 1, CONFERENCIAS_HISTORICO + 1, foraDosQuadros, falhas);
+
+    // Série dos turnos guardados em até PONTOS_SERIE pontos, terminando no último
+    int passo = (disponiveis - 1) / (PONTOS_SERIE - 1);
+    passo = (passo > 0) ? passo : 1;
+    int inicioSerie = historico.turnoAtual - passo * (PONTOS_SERIE - 1);
+    inicioSerie = (inicioSerie > primeiro) ? inicioSerie : primeiro;
+    int serieTerritorios[PONTOS_SERIE * TOTAL_CORES_SIMULACAO];
+    long long serieTropas[PONTOS_SERIE * TOTAL_CORES_SIMULACAO];
+    inicio = agoraSegundos();
+    int pontos = serieJogadores(&historico, inicioSerie, historico.turnoAtual, passo,
+                                serieTerritorios, serieTropas);
+    double duracaoSerie = agoraSegundos() - inicio;
+
+    printf("\nTerritórios/tropas por jogador (série em %.2f ms):\n", duracaoSerie * 1e3);
+    printf("%10s", "Turno");
+    for (int j = 0; j < quantidadeJogadores; j++)
+    {
+        printf(" %14s", coresSimulacao[j]);
+    }
+    printf("\n");
+    for (int p = 0; p < pontos; p++)
+    {
+        printf("%10d", inicioSerie + p * passo);
+        for (int j = 0; j < quantidadeJogadores; j++)
+        {
+            char celula[32];
+            snprintf(celula, sizeof(celula), "%d/%lld", serieTerritorios[p * quantidadeJogadores + j],
+                     serieTropas[p * quantidadeJogadores + j]);
+            printf(" %14s", celula);
+        }
+        printf("\n");
+    }
+
+    printf(falhas == 0 ? "✅ Consultas conferem com a partida\n" : "❌ Consultas divergem da partida!\n");
+    liberarHistorico(&historico);
+    free(mapa);
+    free(consulta);
+    return falhas != 0;
+}
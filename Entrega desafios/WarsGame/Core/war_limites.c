@@ -0,0 +1,159 @@
+// NÚCLEO DO JOGO DE GUERRA - LIMITES DE RECURSOS POR PARTIDA
+//
+// OBJETIVO:
+// Impedir que uma partida gigante (a quantidade de territórios aceita
+// qualquer inteiro) tome a memória e a CPU das outras em um servidor:
+// - cada categoria (LIMITES_CASUAL, LIMITES_RANQUEADA, LIMITES_TORNEIO)
+//   define a memória de territórios e missões aceita e a CPU de um turno
+// - conferirMemoria() recusa a partida antes de qualquer alocação: a
+//   memória vem do orçamento da partida (orcamentoJogo ou memoriaPartida),
+//   não de um contador no caminho de cada ataque
+// - registrarCpuTurno() recebe a CPU de um turno, lida do relógio da
+//   própria thread (cpuThreadNs), e devolve quanto a partida deve esperar
+// O relógio da thread não conta o tempo em que ela está parada (esperando
+// o jogador digitar ou outra partida jogar), então mede só o que o turno
+// gastou. Sem limites (NULL), nada é medido.
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <string.h>
+#include <time.h>
+
+#include "war_core.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+#define BYTES_POR_MB (1024 * 1024)
+#define NS_POR_MS 1000000LL
+
+// ============================================================================
+// LIMITES DE CADA CATEGORIA
+// Memória, CPU de um turno e cota de CPU (milésimos de um núcleo) de uma
+// partida freada
+// ============================================================================
+const LimitesPartida LIMITES_CASUAL = {"casual", (size_t)16 * BYTES_POR_MB, 2 * NS_POR_MS, 50};
+const LimitesPartida LIMITES_RANQUEADA = {"ranqueada", (size_t)64 * BYTES_POR_MB, 10 * NS_POR_MS, 100};
+const LimitesPartida LIMITES_TORNEIO = {"torneio", (size_t)512 * BYTES_POR_MB, 50 * NS_POR_MS, 250};
+
+static const LimitesPartida *const categorias[] = {&LIMITES_CASUAL, &LIMITES_RANQUEADA, &LIMITES_TORNEIO};
+
+// ============================================================================
+// FUNÇÃO: buscarLimites
+// DESCRIÇÃO: Limites de uma categoria pelo nome
+// PARÂMETROS: categoria (ex.: "casual")
+// RETORNO: limites da categoria, ou NULL se ela não existir
+// ============================================================================
+const LimitesPartida *buscarLimites(const char *categoria)
+{
+    for (size_t i = 0; i < sizeof(categorias) / sizeof(categorias[0]); i++)
+    {
+        if (strcmp(categoria, categorias[i]->categoria) == 0)
+        {
+            return categorias[i];
+        }
+    }
+    return NULL;
+}
+
+// ============================================================================
+// FUNÇÃO: conferirMemoria
+// DESCRIÇÃO: Confere se uma partida cabe no limite de memória da categoria
+// PARÂMETROS: limites (ou NULL), bytes (territórios e missões da partida)
+// RETORNO: 0 se a partida pode ser criada, 1 se deve ser recusada
+// ============================================================================
+int conferirMemoria(const LimitesPartida *limites, size_t bytes)
+{
+    return limites != NULL && limites->memoriaMaxima > 0 && bytes > limites->memoriaMaxima;
+}
+
+// ============================================================================
+// FUNÇÃO: cpuThreadNs
+// DESCRIÇÃO: Lê o relógio de CPU da thread atual
+// RETORNO: CPU usada pela thread até agora, em nanossegundos
+// ============================================================================
+long long cpuThreadNs(void)
+{
+#ifdef CLOCK_THREAD_CPUTIME_ID
+    struct timespec instante;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &instante);
+    return (long long)instante.tv_sec * 1000000000LL + instante.tv_nsec;
+#else
+    // Sem relógio por thread, o do processo (igual quando há uma só thread)
+    return (long long)((double)clock() * 1e9 / CLOCKS_PER_SEC);
+#endif
+}
+
+// ============================================================================
+// FUNÇÃO: registrarCpuTurno
+// DESCRIÇÃO: Soma a CPU de um turno ao consumo da partida e aplica o limite
+//            da categoria. Um turno acima do limite freia a partida pelo
+//            tempo que ele levaria com a cota de CPU da categoria (com cota
+//            de 50 milésimos, um turno de 4 ms espera 80 ms).
+// PARÂMETROS: consumo (da partida), limites (da categoria), cpuNs (do turno)
+// RETORNO: espera antes do próximo turno, em milissegundos (0 = sem freio)
+// ============================================================================
+long long registrarCpuTurno(ConsumoPartida *consumo, const LimitesPartida *limites, long long cpuNs)
+{
+    consumo->cpuTotalNs += cpuNs;
+    consumo->turnosMedidos++;
+    if (cpuNs > consumo->cpuMaiorTurnoNs)
+    {
+        consumo->cpuMaiorTurnoNs = cpuNs;
+    }
+    metricas.cpuTurnosSegundos += cpuNs / 1e9;
+
+    if (limites->cpuTurnoNs <= 0 || cpuNs <= limites->cpuTurnoNs || limites->cotaCpuPorMil <= 0)
+    {
+        return 0;
+    }
+
+    long long espera = (cpuNs * 1000 / limites->cotaCpuPorMil + NS_POR_MS - 1) / NS_POR_MS;
+    consumo->turnosFreados++;
+    consumo->esperaFreioMs += espera;
+    metricas.turnosFreados++;
+    return espera;
+}
+
+// ============================================================================
+// FUNÇÃO: juntarConsumo
+// DESCRIÇÃO: Acumula o consumo de uma partida em um total (a memória fica
+//            com a maior partida, o resto é somado)
+// PARÂMETROS: destino (total), origem (consumo de uma partida)
+// ============================================================================
+void juntarConsumo(ConsumoPartida *destino, const ConsumoPartida *origem)
+{
+    if (origem->memoriaBytes > destino->memoriaBytes)
+    {
+        destino->memoriaBytes = origem->memoriaBytes;
+    }
+    if (origem->cpuMaiorTurnoNs > destino->cpuMaiorTurnoNs)
+    {
+        destino->cpuMaiorTurnoNs = origem->cpuMaiorTurnoNs;
+    }
+    destino->cpuTotalNs += origem->cpuTotalNs;
+    destino->turnosMedidos += origem->turnosMedidos;
+    destino->turnosFreados += origem->turnosFreados;
+    destino->esperaFreioMs += origem->esperaFreioMs;
+}
+
+// ============================================================================
+// FUNÇÃO: esperarFreio
+// DESCRIÇÃO: Suspende a thread pelo freio de uma partida (jogo interativo;
+//            o escalonador só adia a partida no relógio virtual)
+// PARÂMETROS: milissegundos (retorno de registrarCpuTurno)
+// ============================================================================
+void esperarFreio(long long milissegundos)
+{
+    if (milissegundos <= 0)
+    {
+        return;
+    }
+#ifdef _WIN32
+    Sleep((DWORD)milissegundos);
+#else
+    struct timespec espera = {(time_t)(milissegundos / 1000), (long)(milissegundos % 1000) * NS_POR_MS};
+    nanosleep(&espera, NULL);
+#endif
+}
@@ -0,0 +1,574 @@
+// NÚCLEO DO JOGO DE GUERRA - PARTIDAS EM REDE POR LOCKSTEP
+//
+// OBJETIVO:
+// Jogar uma partida entre dois processos trocando apenas comandos. O motor
+// é determinístico para uma mesma semente, então cada par guarda a partida
+// inteira e aplica os mesmos comandos na mesma ordem:
+// - a cada turno os dois pares enviam uma mensagem: número do turno, o
+//   comando do jogador da vez (atacante e defensor, ou "passa" quando o
+//   jogador não é deste par) e 32 bits da soma de verificação do estado
+// - só depois de receber a mensagem do outro par o turno é aplicado
+// - a soma do mapa é atualizada a cada ataque (só os dois territórios
+//   tocados), então conferir o estado custa O(1) por turno
+// Somas diferentes no mesmo turno denunciam uma dessincronia (um bug não
+// determinístico ou um par adulterado) e a sessão é encerrada.
+//
+// Cada processo intercala milhares de sessões em uma thread com poll(),
+// como o escalonador. Usa sockets locais (socketpair) e fork(): só em
+// sistemas POSIX.
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "war_core.h"
+
+#ifndef _WIN32
+#include <errno.h>
+#include <poll.h>
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+#define TURNO_COM_FALHA 10         // Turno em que a sessão com falha é adulterada (ela dura ao menos até ele)
+#define ESPERA_MAXIMA_MS 10000     // Sem mensagem nesse tempo, o outro par caiu
+
+#ifndef _WIN32
+
+// ============================================================================
+// FUNÇÃO: misturar
+// DESCRIÇÃO: Espalha os bits de um valor (finalizador do splitmix64)
+// ============================================================================
+static unsigned long long misturar(unsigned long long valor)
+{
+    valor = (valor ^ (valor >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    valor = (valor ^ (valor >> 27)) * 0x94D049BB133111EBULL;
+    return valor ^ (valor >> 31);
+}
+
+// ============================================================================
+// FUNÇÃO: hashTerritorio
+// DESCRIÇÃO: Contribuição de um território para a soma do mapa
+// ============================================================================
+static unsigned long long hashTerritorio(int id, const Territorio *territorio)
+{
+    return misturar(((unsigned long long)(unsigned int)id << 32) ^
+                    ((unsigned long long)(unsigned int)territorio->dono << 24) ^
+                    (unsigned long long)(unsigned int)territorio->tropas);
+}
+
+// ============================================================================
+// FUNÇÃO: somaVerificacao
+// DESCRIÇÃO: 32 bits que resumem o estado da sessão: mapa, gerador e turno
+// ============================================================================
+static unsigned int somaVerificacao(const SessaoLockstep *sessao)
+{
+    const Partida *partida = &sessao->partida;
+    return (unsigned int)(misturar(sessao->somaMapa ^ misturar(partida->estadoAleatorio) ^
+                                   (unsigned long long)partida->turnos) >> 32);
+}
+
+// ============================================================================
+// FUNÇÃO: iniciarSessao
+// DESCRIÇÃO: Cria a partida da sessão (igual nos dois pares) e o gerador
+//            privado das escolhas dos jogadores deste par
+// PARÂMETROS: sessao, semente, quantidadeTerritorios / quantidadeJogadores
+//             lado (0 ou 1: jogadores pares ou ímpares), conexao (socket)
+// RETORNO: 0 em caso de sucesso, 1 em caso de falha de alocação
+// ============================================================================
+static int iniciarSessao(SessaoLockstep *sessao, unsigned long long semente, int quantidadeTerritorios,
+                         int quantidadeJogadores, int lado, int conexao)
+{
+    memset(sessao, 0, sizeof(SessaoLockstep));
+    sessao->conexao = conexao;
+    sessao->lado = lado;
+    sessao->turnoComFalha = -1;
+    if (criarPartida(&sessao->partida, semente, quantidadeTerritorios, quantidadeJogadores, 0, NULL) != 0)
+    {
+        return 1;
+    }
+
+    for (int t = 0; t < quantidadeTerritorios; t++)
+    {
+        sessao->somaMapa += hashTerritorio(t, &sessao->partida.mapa[t]);
+    }
+    for (int j = lado; j < quantidadeJogadores; j += 2)
+    {
+        sessao->jogadoresLocais |= 1 << j;
+    }
+
+    // As escolhas são entradas do jogo: cada par tem o seu próprio gerador
+    semearAleatorio(~semente ^ (unsigned long long)lado);
+    sessao->estadoEscolhas = salvarAleatorio();
+    return 0;
+}
+
+// ============================================================================
+// FUNÇÃO: enviarTurno
+// DESCRIÇÃO: Decide o comando local do turno (se o jogador da vez é deste
+//            par) e envia a mensagem:
+//            [tamanho][turno][atacante + 1][defensor + 1][soma, 4 bytes]
+//            (números em varint; 0 em atacante/defensor = passa a vez)
+// PARÂMETROS: sessao
+// RETORNO: 0 em caso de sucesso, 1 se o envio falhar
+// ============================================================================
+static int enviarTurno(SessaoLockstep *sessao)
+{
+    Partida *partida = &sessao->partida;
+    int jogador = partida->jogadorDaVez;
+    unsigned char mensagem[MAX_MENSAGEM_LOCKSTEP];
+
+    // Simula um bug não determinístico em um dos pares
+    if (sessao->lado == 1 && partida->turnos == sessao->turnoComFalha)
+    {
+        Territorio *territorio = &partida->mapa[0];
+        sessao->somaMapa -= hashTerritorio(0, territorio);
+        territorio->tropas++;
+        sessao->somaMapa += hashTerritorio(0, territorio);
+    }
+
+    sessao->atacante = -1;
+    sessao->defensor = -1;
+    if ((sessao->jogadoresLocais >> jogador) & 1)
+    {
+        restaurarAleatorio(sessao->estadoEscolhas);
+        sessao->atacante = escolherJogada(partida->mapa, partida->quantidadeTerritorios,
+                                          partida->donoJogador[jogador], &sessao->defensor);
+        sessao->estadoEscolhas = salvarAleatorio();
+    }
+
+    int tamanho = 1;
+    tamanho += escreverVarint(mensagem + tamanho, (unsigned int)partida->turnos);
+    tamanho += escreverVarint(mensagem + tamanho, (unsigned int)(sessao->atacante + 1));
+    tamanho += escreverVarint(mensagem + tamanho, (unsigned int)(sessao->defensor + 1));
+    unsigned int soma = somaVerificacao(sessao);
+    for (int b = 0; b < 4; b++)
+    {
+        mensagem[tamanho++] = (unsigned char)(soma >> (8 * b));
+    }
+    mensagem[0] = (unsigned char)(tamanho - 1);
+
+    for (int enviados = 0; enviados < tamanho;)
+    {
+        ssize_t escritos = write(sessao->conexao, mensagem + enviados, (size_t)(tamanho - enviados));
+        if (escritos < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (escritos <= 0)
+        {
+            return 1;
+        }
+        enviados += (int)escritos;
+    }
+
+    sessao->bytesEnviados += tamanho;
+    sessao->enviado = 1;
+    return 0;
+}
+
+// ============================================================================
+// FUNÇÃO: aplicarTurno
+// DESCRIÇÃO: Aplica o comando do jogador da vez, igual nos dois pares.
+//            Comandos inválidos (território de outro dono, IDs fora do mapa)
+//            viram "passa a vez" nos dois lados, sem dessincronizar.
+// PARÂMETROS: sessao, idAtacante / idDefensor (-1 = passa a vez)
+// ============================================================================
+static void aplicarTurno(SessaoLockstep *sessao, int idAtacante, int idDefensor)
+{
+    Partida *partida = &sessao->partida;
+    Territorio *mapa = partida->mapa;
+    int quantidade = partida->quantidadeTerritorios;
+
+    int valido = idAtacante >= 0 && idAtacante < quantidade && idDefensor >= 0 &&
+                 idDefensor < quantidade && idAtacante != idDefensor &&
+                 mapa[idAtacante].dono == partida->donoJogador[partida->jogadorDaVez];
+
+    const RegrasJogo *regrasDaThread = regras;
+    usarRegras(partida->regras);
+    restaurarAleatorio(partida->estadoAleatorio);
+    if (valido)
+    {
+        sessao->somaMapa -= hashTerritorio(idAtacante, &mapa[idAtacante]) +
+                            hashTerritorio(idDefensor, &mapa[idDefensor]);
+        resolverAtaque(&mapa[idAtacante], &mapa[idDefensor]);
+        sessao->somaMapa += hashTerritorio(idAtacante, &mapa[idAtacante]) +
+                            hashTerritorio(idDefensor, &mapa[idDefensor]);
+    }
+    partida->turnos++;
+    partida->vencedor = verificarVencedor(partida->missoes, partida->donoJogador, mapa, partida->quantidadeJogadores,
+                                          quantidade);
+    partida->jogadorDaVez = (partida->jogadorDaVez + 1) % partida->quantidadeJogadores;
+    partida->estadoAleatorio = salvarAleatorio();
+    usarRegras(regrasDaThread);
+    sessao->enviado = 0;
+}
+
+// ============================================================================
+// FUNÇÃO: receberTurnos
+// DESCRIÇÃO: Lê o que chegou do outro par e aplica os turnos completos
+// PARÂMETROS: sessao
+// RETORNO: 0 para continuar, 1 se a partida terminou (ou dessincronizou),
+//          -1 se o outro par caiu ou mandou uma mensagem inválida
+// ============================================================================
+static int receberTurnos(SessaoLockstep *sessao)
+{
+    ssize_t lidos = read(sessao->conexao, sessao->recebido + sessao->tamanhoRecebido,
+                         sizeof(sessao->recebido) - (size_t)sessao->tamanhoRecebido);
+    if (lidos < 0 && errno == EINTR)
+    {
+        return 0;
+    }
+    if (lidos <= 0)
+    {
+        return -1;
+    }
+    sessao->tamanhoRecebido += (int)lidos;
+
+    while (sessao->tamanhoRecebido > 0 && sessao->tamanhoRecebido >= 1 + sessao->recebido[0])
+    {
+        // O outro par pode estar um turno à frente: responde antes de aplicar
+        if (!sessao->enviado && enviarTurno(sessao) != 0)
+        {
+            return -1;
+        }
+
+        int tamanho = 1 + sessao->recebido[0];
+        size_t posicao = 1;
+        unsigned int turno, atacante, defensor;
+        if (tamanho > MAX_MENSAGEM_LOCKSTEP ||
+            !lerVarintMemoria(sessao->recebido, (size_t)tamanho, &posicao, &turno) ||
+            !lerVarintMemoria(sessao->recebido, (size_t)tamanho, &posicao, &atacante) ||
+            !lerVarintMemoria(sessao->recebido, (size_t)tamanho, &posicao, &defensor) ||
+            posicao + 4 != (size_t)tamanho || turno != (unsigned int)sessao->partida.turnos)
+        {
+            return -1;
+        }
+
+        unsigned int soma = 0;
+        for (int b = 0; b < 4; b++)
+        {
+            soma |= (unsigned int)sessao->recebido[posicao + b] << (8 * b);
+        }
+        if (soma != somaVerificacao(sessao))
+        {
+            sessao->dessincronizada = 1;
+            return 1;
+        }
+
+        // Vale o comando de quem controla o jogador da vez
+        if ((sessao->jogadoresLocais >> sessao->partida.jogadorDaVez) & 1)
+        {
+            aplicarTurno(sessao, sessao->atacante, sessao->defensor);
+        }
+        else
+        {
+            aplicarTurno(sessao, (int)atacante - 1, (int)defensor - 1);
+        }
+
+        sessao->tamanhoRecebido -= tamanho;
+        memmove(sessao->recebido, sessao->recebido + tamanho, (size_t)sessao->tamanhoRecebido);
+
+        // A sessão com falha continua até o turno da falha mesmo se alguém
+        // vencer antes: a detecção não depende de a partida ser longa
+        int venceu = sessao->partida.vencedor != -1 && sessao->partida.turnos > sessao->turnoComFalha;
+        if (venceu || sessao->partida.turnos >= MAX_TURNOS_SIMULACAO)
+        {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+// ============================================================================
+// FUNÇÃO: executarLado
+// DESCRIÇÃO: Joga todas as sessões de um par até o fim: envia o turno de
+//            cada sessão que ainda não enviou e espera (poll) as respostas
+// PARÂMETROS: sessoes / quantidade
+// RETORNO: quantidade de sessões que terminaram por queda ou erro
+// ============================================================================
+static int executarLado(SessaoLockstep *sessoes, int quantidade)
+{
+    struct pollfd *esperas = (struct pollfd *)malloc((size_t)quantidade * sizeof(struct pollfd));
+    int *indices = (int *)malloc((size_t)quantidade * sizeof(int));
+    int erros = 0;
+    if (esperas == NULL || indices == NULL)
+    {
+        free(esperas);
+        free(indices);
+        return quantidade;
+    }
+
+    int ativas = 0;
+    for (int i = 0; i < quantidade; i++)
+    {
+        ativas += sessoes[i].conexao >= 0;
+    }
+
+    while (ativas > 0)
+    {
+        int esperando = 0;
+        for (int i = 0; i < quantidade; i++)
+        {
+            SessaoLockstep *sessao = &sessoes[i];
+            if (sessao->conexao < 0)
+            {
+                continue;
+            }
+
+            if (!sessao->enviado && enviarTurno(sessao) != 0)
+            {
+                close(sessao->conexao);
+                sessao->conexao = -1;
+                ativas--;
+                erros++;
+                continue;
+            }
+
+            esperas[esperando].fd = sessao->conexao;
+            esperas[esperando].events = POLLIN;
+            esperas[esperando].revents = 0;
+            indices[esperando++] = i;
+        }
+
+        int prontas = poll(esperas, (nfds_t)esperando, ESPERA_MAXIMA_MS);
+        if (prontas < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (prontas <= 0)
+        {
+            // Nenhuma resposta: o outro par caiu
+            for (int k = 0; k < esperando; k++)
+            {
+                close(esperas[k].fd);
+                sessoes[indices[k]].conexao = -1;
+            }
+            erros += esperando;
+            break;
+        }
+
+        for (int k = 0; k < esperando; k++)
+        {
+            if (esperas[k].revents == 0)
+            {
+                continue;
+            }
+
+            SessaoLockstep *sessao = &sessoes[indices[k]];
+            int resultado = receberTurnos(sessao);
+            if (resultado != 0)
+            {
+                close(sessao->conexao);
+                sessao->conexao = -1;
+                ativas--;
+                erros += resultado < 0;
+            }
+        }
+    }
+
+    free(esperas);
+    free(indices);
+    return erros;
+}
+
+// ============================================================================
+// FUNÇÃO: jogarLado
+// DESCRIÇÃO: Cria as sessões de um par a partir das conexões e as joga
+// PARÂMETROS: conexoes (um socket por sessão), quantidadeSessoes, semente,
+//             quantidadeTerritorios / quantidadeJogadores, lado, sessaoComFalha
+//             (adulterada pelo lado 1 no TURNO_COM_FALHA, ou -1)
+//             turnos / bytes / vencedores / dessincronias (saídas)
+//             turnosSessaoComFalha (saída: turnos em que ela parou, ou -1)
+// RETORNO: sessões com erro (queda, mensagem inválida ou falta de memória)
+// ============================================================================
+static int jogarLado(const int *conexoes, int quantidadeSessoes, unsigned long long semente,
+                     int quantidadeTerritorios, int quantidadeJogadores, int lado, int sessaoComFalha,
+                     long long *turnos, long long *bytes, int *vencedores, int *dessincronias,
+                     int *turnosSessaoComFalha)
+{
+    SessaoLockstep *sessoes = (SessaoLockstep *)calloc((size_t)quantidadeSessoes, sizeof(SessaoLockstep));
+    if (sessoes == NULL)
+    {
+        return quantidadeSessoes;
+    }
+
+    int erros = 0;
+    for (int i = 0; i < quantidadeSessoes; i++)
+    {
+        if (iniciarSessao(&sessoes[i], semente + (unsigned long long)i, quantidadeTerritorios,
+                          quantidadeJogadores, lado, conexoes[i]) != 0)
+        {
+            close(conexoes[i]);
+            sessoes[i].conexao = -1;
+            erros++;
+        }
+    }
+    // Os dois lados mantêm a sessão viva até a falha; só o lado 1 a injeta
+    if (sessaoComFalha >= 0 && sessaoComFalha < quantidadeSessoes)
+    {
+        sessoes[sessaoComFalha].turnoComFalha = TURNO_COM_FALHA;
+    }
+
+    erros += executarLado(sessoes, quantidadeSessoes);
+
+    *turnos = 0;
+    *bytes = 0;
+    *vencedores = 0;
+    *dessincronias = 0;
+    *turnosSessaoComFalha = -1;
+    if (sessaoComFalha >= 0 && sessaoComFalha < quantidadeSessoes)
+    {
+        *turnosSessaoComFalha = sessoes[sessaoComFalha].partida.turnos;
+    }
+    for (int i = 0; i < quantidadeSessoes; i++)
+    {
+        *turnos += sessoes[i].partida.turnos;
+        *bytes += sessoes[i].bytesEnviados;
+        *vencedores += sessoes[i].partida.vencedor >= 0 && !sessoes[i].dessincronizada;
+        *dessincronias += sessoes[i].dessincronizada;
+        liberarPartida(&sessoes[i].partida);
+    }
+    free(sessoes);
+    return erros;
+}
+
+#endif
+
+// ============================================================================
+// FUNÇÃO: executarLockstep
+// DESCRIÇÃO: Joga várias partidas em lockstep entre este processo e um par
+//            local (processo filho), uma conexão por sessão, e mostra o
+//            tráfego por turno e as dessincronias detectadas
+// PARÂMETROS: semente (sessão i usa semente + i), quantidadeSessoes
+//             quantidadeTerritorios / quantidadeJogadores (tamanho do jogo)
+//             sessaoComFalha (sessão adulterada pelo par para testar a
+//             detecção, ou -1)
+// RETORNO: 0 se tudo terminou como esperado, 1 caso contrário
+// ============================================================================
+int executarLockstep(unsigned long long semente, int quantidadeSessoes, int quantidadeTerritorios,
+                     int quantidadeJogadores, int sessaoComFalha)
+{
+#ifdef _WIN32
+    (void)semente;
+    (void)quantidadeSessoes;
+    (void)quantidadeTerritorios;
+    (void)quantidadeJogadores;
+    (void)sessaoComFalha;
+    printf("❌ Erro: O lockstep local precisa de um sistema POSIX (fork e socketpair)!\n");
+    return 1;
+#else
+    // Dois sockets por sessão até o fork: sobe o limite de arquivos abertos
+    struct rlimit limite;
+    rlim_t necessarios = (rlim_t)quantidadeSessoes * 2 + 16;
+    if (getrlimit(RLIMIT_NOFILE, &limite) == 0 && limite.rlim_cur < necessarios)
+    {
+        limite.rlim_cur = (limite.rlim_max == RLIM_INFINITY || limite.rlim_max >= necessarios)
+                              ? necessarios
+                              : limite.rlim_max;
+        setrlimit(RLIMIT_NOFILE, &limite);
+    }
+
+    int *conexoes = (int *)malloc((size_t)quantidadeSessoes * 2 * sizeof(int));
+    if (conexoes == NULL)
+    {
+        printf("❌ Erro: Falha na alocação de memória para as conexões!\n");
+        return 1;
+    }
+    for (int i = 0; i < quantidadeSessoes; i++)
+    {
+        if (socketpair(AF_UNIX, SOCK_STREAM, 0, &conexoes[2 * i]) != 0)
+        {
+            printf("❌ Erro: Não foi possível criar a conexão %d (%s)!\n", i, strerror(errno));
+            for (int k = 0; k < 2 * i; k++)
+            {
+                close(conexoes[k]);
+            }
+            free(conexoes);
+            return 1;
+        }
+    }
+
+    // Cada lado fica com uma ponta de cada conexão
+    int *pontasLocais = (int *)malloc((size_t)quantidadeSessoes * sizeof(int));
+    if (pontasLocais == NULL)
+    {
+        free(conexoes);
+        return 1;
+    }
+
+    fflush(stdout);
+    pid_t par = fork();
+    if (par < 0)
+    {
+        printf("❌ Erro: Não foi possível iniciar o par local!\n");
+        for (int k = 0; k < 2 * quantidadeSessoes; k++)
+        {
+            close(conexoes[k]);
+        }
+        free(conexoes);
+        free(pontasLocais);
+        return 1;
+    }
+
+    int lado = (par == 0) ? 1 : 0;
+    for (int i = 0; i < quantidadeSessoes; i++)
+    {
+        close(conexoes[2 * i + 1 - lado]);
+        pontasLocais[i] = conexoes[2 * i + lado];
+    }
+    free(conexoes);
+
+    long long turnos = 0, bytes = 0;
+    int vencedores = 0, dessincronias = 0, turnosSessaoComFalha = -1;
+    double inicio = agoraSegundos();
+    int erros = jogarLado(pontasLocais, quantidadeSessoes, semente, quantidadeTerritorios,
+                          quantidadeJogadores, lado, sessaoComFalha, &turnos, &bytes,
+                          &vencedores, &dessincronias, &turnosSessaoComFalha);
+    double duracao = agoraSegundos() - inicio;
+    free(pontasLocais);
+
+    // A sessão com falha sempre chega ao TURNO_COM_FALHA; a dessincronia
+    // aparece na mensagem desse turno e para a sessão nele nos dois pares
+    int esperadas = sessaoComFalha >= 0 && sessaoComFalha < quantidadeSessoes;
+    int correto = erros == 0 && dessincronias == esperadas &&
+                  (!esperadas || turnosSessaoComFalha == TURNO_COM_FALHA);
+    if (par == 0)
+    {
+        _exit(correto ? 0 : 1);
+    }
+
+    int estado = 0;
+    waitpid(par, &estado, 0);
+    int parCorreto = WIFEXITED(estado) && WEXITSTATUS(estado) == 0;
+
+    printf("Sessões: %d | Territórios: %d | Jogadores: %d (pares x ímpares)\n",
+           quantidadeSessoes, quantidadeTerritorios, quantidadeJogadores);
+    printf("Turnos jogados: %lld (%.1f por sessão, %d partidas com vencedor)\n", turnos,
+           quantidadeSessoes > 0 ? (double)turnos / quantidadeSessoes : 0.0, vencedores);
+    printf("Tempo: %.3f s (%.0f turnos/s, ida e volta entre processos)\n",
+           duracao, duracao > 0.0 ? turnos / duracao : 0.0);
+    printf("Tráfego por par: %.2f bytes por turno (mapa inteiro: %zu bytes)\n",
+           turnos > 0 ? (double)bytes / turnos : 0.0,
+           (size_t)quantidadeTerritorios * sizeof(Territorio));
+    printf("Memória por sessão: ~%zu bytes\n",
+           sizeof(SessaoLockstep) + (size_t)quantidadeTerritorios * sizeof(Territorio));
+    printf("Dessincronias detectadas: %d (esperadas: %d)\n", dessincronias, esperadas);
+    if (esperadas)
+    {
+        printf("Sessão %d: adulterada no turno %d e encerrada no turno %d\n",
+               sessaoComFalha, TURNO_COM_FALHA, turnosSessaoComFalha);
+    }
+    if (erros > 0)
+    {
+        printf("❌ Sessões interrompidas por erro: %d\n", erros);
+    }
+    printf(correto && parCorreto ? "✅ Os pares concordaram em todas as sessões sem falha injetada\n"
+                                 : "❌ Os pares não concordam!\n");
+    return !(correto && parCorreto);
+#endif
+}
@@ -0,0 +1,304 @@
+// NÚCLEO DO JOGO DE GUERRA - MÉTRICAS
+//
+// OBJETIVO:
+// Contar ataques, conquistas, vitórias por missão e a duração dos turnos,
+// e exportar tudo no formato texto do Prometheus. No jogo interativo,
+// mede também o tempo de resposta de cada comando do menu (--latencias).
+
+#include <stdatomic.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "war_core.h"
+
+// ============================================================================
+// MÉTRICAS DO JOGO
+// Limites superiores (em segundos) das faixas de duração do turno
+// Os contadores são por thread, para que threads auxiliares (ambientes em
+// paralelo) não disputem a mesma memória a cada ataque. Ao terminar um
+// trecho paralelo, cada uma soma os seus em metricasJuntadas (sob a trava)
+// e a exportação soma os da thread que exporta com os juntados.
+// ============================================================================
+_Thread_local Metricas metricas;
+static Metricas metricasJuntadas;
+static atomic_flag travaMetricas = ATOMIC_FLAG_INIT;
+
+const double limitesFaixasTurno[TOTAL_FAIXAS_LATENCIA] = {
+    0.000001, 0.00001, 0.0001, 0.001, 0.01, 0.1, 1.0, 10.0};
+
+const char *nomesComandos[TOTAL_COMANDOS] = {
+    "exibir", "atacar", "missoes", "sair", "desfazer", "refazer", "sugerir", "vencedor"};
+
+// ============================================================================
+// FUNÇÃO: agoraSegundos
+// DESCRIÇÃO: Lê o relógio com resolução de nanossegundos
+// RETORNO: instante atual em segundos
+// ============================================================================
+double agoraSegundos()
+{
+    struct timespec instante;
+    timespec_get(&instante, TIME_UTC);
+    return (double)instante.tv_sec + (double)instante.tv_nsec / 1e9;
+}
+
+// ============================================================================
+// FUNÇÃO: registrarDuracaoTurno
+// DESCRIÇÃO: Acrescenta a duração de um turno ao histograma de métricas
+// PARÂMETROS: segundos (duração do processamento do turno)
+// ============================================================================
+void registrarDuracaoTurno(double segundos)
+{
+    int faixa = 0;
+    while (faixa < TOTAL_FAIXAS_LATENCIA && segundos > limitesFaixasTurno[faixa])
+    {
+        faixa++;
+    }
+
+    metricas.faixasTurno[faixa]++;
+    metricas.somaDuracaoTurnos += segundos;
+}
+
+// ============================================================================
+// FUNÇÃO: travarMetricas / destravarMetricas
+// DESCRIÇÃO: Trava de espera ativa de metricasJuntadas (seções curtas, uma
+//            vez por thread a cada trecho paralelo e a cada exportação)
+// ============================================================================
+static void travarMetricas(void)
+{
+    while (atomic_flag_test_and_set_explicit(&travaMetricas, memory_order_acquire))
+    {
+    }
+}
+
+static void destravarMetricas(void)
+{
+    atomic_flag_clear_explicit(&travaMetricas, memory_order_release);
+}
+
+// ============================================================================
+// FUNÇÃO: somarContadores
+// DESCRIÇÃO: Soma os contadores de uma cópia das métricas em outra (os
+//            medidores, partidas ativas e memória, são de quem os define e
+//            não entram na soma)
+// PARÂMETROS: destino, origem
+// ============================================================================
+static void somarContadores(Metricas *destino, const Metricas *origem)
+{
+    destino->ataques += origem->ataques;
+    destino->conquistas += origem->conquistas;
+    for (int i = 0; i < TOTAL_MISSOES; i++)
+    {
+        destino->missoesCumpridas[i] += origem->missoesCumpridas[i];
+    }
+    for (int i = 0; i <= TOTAL_FAIXAS_LATENCIA; i++)
+    {
+        destino->faixasTurno[i] += origem->faixasTurno[i];
+    }
+    destino->somaDuracaoTurnos += origem->somaDuracaoTurnos;
+    destino->cpuTurnosSegundos += origem->cpuTurnosSegundos;
+    destino->turnosFreados += origem->turnosFreados;
+}
+
+// ============================================================================
+// FUNÇÃO: juntarMetricasThread
+// DESCRIÇÃO: Passa os contadores da thread para os que exportarMetricas
+//            lê e zera os da thread. Cada thread de um trecho paralelo que
+//            joga turnos chama ao terminar a sua parte; sem isso, o que ela
+//            contou nunca seria exportado.
+// ============================================================================
+void juntarMetricasThread(void)
+{
+    travarMetricas();
+    somarContadores(&metricasJuntadas, &metricas);
+    destravarMetricas();
+
+    long long partidasAtivas = metricas.partidasAtivas;
+    long long memoriaBytes = metricas.memoriaBytes;
+    memset(&metricas, 0, sizeof(metricas));
+    metricas.partidasAtivas = partidasAtivas;
+    metricas.memoriaBytes = memoriaBytes;
+}
+
+// ============================================================================
+// FUNÇÃO: lerMetricas
+// DESCRIÇÃO: Métricas do processo: os contadores desta thread somados aos
+//            juntados das threads auxiliares
+// RETORNO: cópia das métricas
+// ============================================================================
+Metricas lerMetricas(void)
+{
+    Metricas total = metricas;
+    travarMetricas();
+    somarContadores(&total, &metricasJuntadas);
+    destravarMetricas();
+    return total;
+}
+
+// ============================================================================
+// FUNÇÃO: exportarMetricas
+// DESCRIÇÃO: Grava as métricas no formato texto do Prometheus. O arquivo é
+//            escrito em uma cópia temporária e renomeado, para que um coletor
+//            (ex.: textfile collector do node_exporter) nunca leia pela metade.
+// PARÂMETROS: caminho (arquivo de destino)
+// RETORNO: 0 em caso de sucesso, 1 em caso de erro
+// ============================================================================
+int exportarMetricas(const char *caminho)
+{
+    char temporario[FILENAME_MAX];
+    snprintf(temporario, sizeof(temporario), "%s.tmp", caminho);
+
+    FILE *arquivo = fopen(temporario, "w");
+    if (arquivo == NULL)
+    {
+        return 1;
+    }
+
+    Metricas total = lerMetricas();
+
+    fprintf(arquivo, "# HELP war_partidas_ativas Partidas em andamento.\n");
+    fprintf(arquivo, "# TYPE war_partidas_ativas gauge\n");
+    fprintf(arquivo, "war_partidas_ativas %lld\n", total.partidasAtivas);
+
+    fprintf(arquivo, "# HELP war_ataques_total Ataques válidos resolvidos.\n");
+    fprintf(arquivo, "# TYPE war_ataques_total counter\n");
+    fprintf(arquivo, "war_ataques_total %llu\n", total.ataques);
+
+    fprintf(arquivo, "# HELP war_conquistas_total Ataques que trocaram o dono do território.\n");
+    fprintf(arquivo, "# TYPE war_conquistas_total counter\n");
+    fprintf(arquivo, "war_conquistas_total %llu\n", total.conquistas);
+
+    fprintf(arquivo, "# HELP war_missoes_cumpridas_total Vitórias por missão (índice em missoesPredefinidas).\n");
+    fprintf(arquivo, "# TYPE war_missoes_cumpridas_total counter\n");
+    for (int i = 0; i < TOTAL_MISSOES; i++)
+    {
+        fprintf(arquivo, "war_missoes_cumpridas_total{missao=\"%d\"} %llu\n",
+                i, total.missoesCumpridas[i]);
+    }
+
+    // Faixas do histograma são cumulativas no formato do Prometheus
+    unsigned long long acumulado = 0;
+    fprintf(arquivo, "# HELP war_duracao_turno_segundos Tempo de processamento de cada turno.\n");
+    fprintf(arquivo, "# TYPE war_duracao_turno_segundos histogram\n");
+    for (int i = 0; i < TOTAL_FAIXAS_LATENCIA; i++)
+    {
+        acumulado += total.faixasTurno[i];
+        fprintf(arquivo, "war_duracao_turno_segundos_bucket{le=\"%g\"} %llu\n",
+                limitesFaixasTurno[i], acumulado);
+    }
+    acumulado += total.faixasTurno[TOTAL_FAIXAS_LATENCIA];
+    fprintf(arquivo, "war_duracao_turno_segundos_bucket{le=\"+Inf\"} %llu\n", acumulado);
+    fprintf(arquivo, "war_duracao_turno_segundos_sum %.9f\n", total.somaDuracaoTurnos);
+    fprintf(arquivo, "war_duracao_turno_segundos_count %llu\n", acumulado);
+
+    fprintf(arquivo, "# HELP war_memoria_bytes Memória usada por territórios e missões.\n");
+    fprintf(arquivo, "# TYPE war_memoria_bytes gauge\n");
+    fprintf(arquivo, "war_memoria_bytes %lld\n", total.memoriaBytes);
+
+    fprintf(arquivo, "# HELP war_cpu_turnos_segundos_total CPU gasta nos turnos medidos (partidas com limites).\n");
+    fprintf(arquivo, "# TYPE war_cpu_turnos_segundos_total counter\n");
+    fprintf(arquivo, "war_cpu_turnos_segundos_total %.9f\n", total.cpuTurnosSegundos);
+
+    fprintf(arquivo, "# HELP war_turnos_freados_total Turnos acima do limite de CPU da categoria.\n");
+    fprintf(arquivo, "# TYPE war_turnos_freados_total counter\n");
+    fprintf(arquivo, "war_turnos_freados_total %llu\n", total.turnosFreados);
+
+    if (estatisticasBatalhas != NULL)
+    {
+        exportarEstatisticas(arquivo, estatisticasBatalhas);
+    }
+
+    if (fclose(arquivo) != 0)
+    {
+        return 1;
+    }
+
+    // Em sistemas onde rename() não substitui o destino, remove-o antes
+    if (rename(temporario, caminho) != 0)
+    {
+        remove(caminho);
+        return rename(temporario, caminho) != 0;
+    }
+    return 0;
+}
+
+// ============================================================================
+// FUNÇÃO: iniciarLatencias
+// DESCRIÇÃO: Zera os histogramas de tempo de resposta e abre o registro da
+//            sessão (uma linha por comando executado)
+// PARÂMETROS: latencias, caminho (arquivo do registro da sessão)
+// RETORNO: 0 em caso de sucesso, 1 se o registro não puder ser criado
+// ============================================================================
+int iniciarLatencias(LatenciasComandos *latencias, const char *caminho)
+{
+    memset(latencias, 0, sizeof(*latencias));
+    latencias->registro = fopen(caminho, "w");
+    if (latencias->registro == NULL)
+    {
+        return 1;
+    }
+
+    latencias->inicioSessao = agoraSegundos();
+    fprintf(latencias->registro, "# instante_s comando duracao_us\n");
+    return 0;
+}
+
+// ============================================================================
+// FUNÇÃO: registrarLatencia
+// DESCRIÇÃO: Acrescenta uma execução de comando ao histograma do comando e ao
+//            registro da sessão
+// PARÂMETROS: latencias, comando, segundos (tempo de resposta, sem a espera
+//             pela digitação do jogador)
+// ============================================================================
+void registrarLatencia(LatenciasComandos *latencias, ComandoMenu comando, double segundos)
+{
+    if (segundos < 0)
+    {
+        segundos = 0;
+    }
+
+    registrarValorHistograma(&latencias->comandos[comando], (unsigned long long)(segundos * 1e9));
+    if (latencias->registro != NULL)
+    {
+        fprintf(latencias->registro, "%.6f %s %.3f\n",
+                agoraSegundos() - latencias->inicioSessao, nomesComandos[comando], segundos * 1e6);
+    }
+}
+
+// ============================================================================
+// FUNÇÃO: encerrarLatencias
+// DESCRIÇÃO: Exibe p50, p99 e máximo de cada comando (em microssegundos),
+//            acrescenta o mesmo resumo ao registro da sessão e o fecha
+// PARÂMETROS: latencias
+// ============================================================================
+void encerrarLatencias(LatenciasComandos *latencias)
+{
+    FILE *saidas[2] = {stdout, latencias->registro};
+
+    for (int s = 0; s < 2 && saidas[s] != NULL; s++)
+    {
+        const char *prefixo = s == 0 ? "" : "# ";
+        fprintf(saidas[s], "\n%sTempo de resposta por comando (µs)\n", prefixo);
+        fprintf(saidas[s], "%s%-10s | %9s | %10s | %10s | %10s\n",
+                prefixo, "Comando", "Execuções", "p50", "p99", "máximo");
+        for (int c = 0; c < TOTAL_COMANDOS; c++)
+        {
+            const HistogramaLog *histograma = &latencias->comandos[c];
+            if (histograma->total == 0)
+            {
+                continue;
+            }
+            fprintf(saidas[s], "%s%-10s | %9llu | %10.1f | %10.1f | %10.1f\n",
+                    prefixo, nomesComandos[c], histograma->total,
+                    quantilHistograma(histograma, 0.50) / 1e3,
+                    quantilHistograma(histograma, 0.99) / 1e3,
+                    histograma->maior / 1e3);
+        }
+    }
+
+    if (latencias->registro != NULL)
+    {
+        fclose(latencias->registro);
+        latencias->registro = NULL;
+    }
+}
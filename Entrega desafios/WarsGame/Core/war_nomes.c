@@ -0,0 +1,405 @@
+// NÚCLEO DO JOGO DE GUERRA - ÍNDICE DOS NOMES DOS TERRITÓRIOS
+//
+// OBJETIVO:
+// Deixar o jogador escolher territórios pelo nome (ou pelo começo do nome)
+// sem percorrer o mapa a cada comando:
+// - nome exato: tabela hash, um hash do texto digitado e uma comparação
+//   (a marca do hash em cada posição evita ler nomes que não combinam)
+// - prefixo: IDs em ordem alfabética, duas buscas binárias delimitam todos
+//   os nomes que começam com o texto (20 comparações em 1 milhão de nomes)
+// O índice é montado uma vez, depois do cadastro ou da carga do cenário.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "war_core.h"
+
+#define MAX_LINHA_COMANDO 256   // Maior linha lida por selecionarTerritorioPorNome
+#define MAX_SUGESTOES 8         // Nomes listados quando o texto é ambíguo
+
+// Mapa usado pela comparação do qsort (que não recebe contexto)
+static _Thread_local const Territorio *mapaOrdenacao;
+
+// ============================================================================
+// FUNÇÃO: minuscula
+// DESCRIÇÃO: Converte uma letra ASCII para minúscula (outros bytes ficam iguais)
+// ============================================================================
+static unsigned char minuscula(unsigned char letra)
+{
+    return (letra >= 'A' && letra <= 'Z') ? (unsigned char)(letra - 'A' + 'a') : letra;
+}
+
+// ============================================================================
+// FUNÇÃO: hashNome
+// DESCRIÇÃO: Hash FNV-1a de 64 bits de um nome, sem diferenciar maiúsculas
+//            (usado também pelo registro de cores)
+// PARÂMETROS: nome, semente (muda o hash sem mudar o algoritmo; 0 = FNV-1a puro)
+// RETORNO: hash (use os bits mais altos: os baixos do FNV se espalham mal)
+// ============================================================================
+unsigned long long hashNome(const char *nome, unsigned long long semente)
+{
+    unsigned long long hash = FNV_BASE ^ semente;
+    for (const unsigned char *c = (const unsigned char *)nome; *c != '\0'; c++)
+    {
+        hash ^= minuscula(*c);
+        hash *= FNV_PRIMO;
+    }
+    return hash;
+}
+
+// ============================================================================
+// FUNÇÃO: compararNomes
+// DESCRIÇÃO: Compara os primeiros "limite" bytes de dois nomes, sem
+//            diferenciar maiúsculas (como strncmp)
+// RETORNO: negativo, zero ou positivo
+// ============================================================================
+static int compararNomes(const char *a, const char *b, size_t limite)
+{
+    const unsigned char *x = (const unsigned char *)a;
+    const unsigned char *y = (const unsigned char *)b;
+    for (; limite > 0; limite--, x++, y++)
+    {
+        int diferenca = (int)minuscula(*x) - (int)minuscula(*y);
+        if (diferenca != 0 || *x == '\0')
+        {
+            return diferenca;
+        }
+    }
+    return 0;
+}
+
+// ============================================================================
+// FUNÇÃO: apararTexto
+// DESCRIÇÃO: Copia o texto sem os espaços das pontas e sem a quebra de linha
+// PARÂMETROS: texto, nome (saída, MAX_NOME bytes)
+// RETORNO: tamanho copiado (0 se o texto for vazio ou maior que um nome)
+// ============================================================================
+static size_t apararTexto(const char *texto, char *nome)
+{
+    while (*texto == ' ' || *texto == '\t')
+    {
+        texto++;
+    }
+    size_t tamanho = strcspn(texto, "\r\n");
+    while (tamanho > 0 && (texto[tamanho - 1] == ' ' || texto[tamanho - 1] == '\t'))
+    {
+        tamanho--;
+    }
+    if (tamanho >= MAX_NOME)
+    {
+        tamanho = 0;
+    }
+    memcpy(nome, texto, tamanho);
+    nome[tamanho] = '\0';
+    return tamanho;
+}
+
+// ============================================================================
+// FUNÇÃO: compararIds
+// DESCRIÇÃO: Ordem alfabética dos IDs para o qsort (empate: menor ID antes)
+// ============================================================================
+static int compararIds(const void *a, const void *b)
+{
+    int idA = *(const int *)a;
+    int idB = *(const int *)b;
+    int ordem = compararNomes(mapaOrdenacao[idA].nome, mapaOrdenacao[idB].nome, MAX_NOME);
+    return (ordem != 0) ? ordem : (idA > idB) - (idA < idB);
+}
+
+// ============================================================================
+// FUNÇÃO: posicoesIndice
+// DESCRIÇÃO: Posições da tabela: pelo menos o dobro dos nomes, para que as
+//            sondagens continuem curtas
+// ============================================================================
+static size_t posicoesIndice(int quantidade)
+{
+    size_t posicoes = 2;
+    while (posicoes < 2 * (size_t)quantidade)
+    {
+        posicoes *= 2;
+    }
+    return posicoes;
+}
+
+// ============================================================================
+// FUNÇÃO: bytesIndiceNomes
+// DESCRIÇÃO: Memória que o índice de um mapa ocupa (orçamento da arena)
+// PARÂMETROS: quantidade (territórios do mapa)
+// RETORNO: bytes, incluindo o alinhamento dos dois blocos na arena
+// ============================================================================
+size_t bytesIndiceNomes(int quantidade)
+{
+    return posicoesIndice(quantidade) * sizeof(unsigned long long) +
+           (size_t)(quantidade > 0 ? quantidade : 1) * sizeof(int) + 2 * ALINHAMENTO_ARENA;
+}
+
+// ============================================================================
+// FUNÇÃO: construirIndiceNomes
+// DESCRIÇÃO: Monta o índice dos nomes de um mapa. Com nomes repetidos, a
+//            busca exata devolve o menor ID (os demais aparecem no prefixo).
+// PARÂMETROS: indice (saída), mapa (deve viver enquanto o índice for usado),
+//             quantidade (territórios do mapa)
+//             arena (orçamento da partida, ou NULL para usar o malloc)
+// RETORNO: 0 em caso de sucesso, 1 se faltar memória
+// ============================================================================
+int construirIndiceNomes(IndiceNomes *indice, const Territorio *mapa, int quantidade, ArenaPartida *arena)
+{
+    memset(indice, 0, sizeof(IndiceNomes));
+    indice->arena = arena;
+
+    size_t posicoes = posicoesIndice(quantidade);
+    indice->tabela = (unsigned long long *)alocarDe(arena, posicoes * sizeof(unsigned long long));
+    indice->ordenados = (int *)alocarDe(arena, (quantidade > 0 ? quantidade : 1) * sizeof(int));
+    if (indice->tabela == NULL || indice->ordenados == NULL)
+    {
+        liberarIndiceNomes(indice);
+        return 1;
+    }
+
+    indice->mapa = mapa;
+    indice->quantidade = quantidade;
+    indice->mascara = (unsigned int)(posicoes - 1);
+
+    for (int id = 0; id < quantidade; id++)
+    {
+        indice->ordenados[id] = id;
+
+        // Nome repetido: fica o menor ID
+        unsigned long long hash = hashNome(mapa[id].nome, 0);
+        unsigned int posicao = (unsigned int)(hash >> 32) & indice->mascara;
+        int repetido = 0;
+        for (; indice->tabela[posicao] != 0 && !repetido; posicao = (posicao + 1) & indice->mascara)
+        {
+            unsigned long long entrada = indice->tabela[posicao];
+            repetido = (entrada >> 32) == (hash & 0xFFFFFFFFu) &&
+                       compararNomes(mapa[(entrada & 0xFFFFFFFFu) - 1].nome, mapa[id].nome, MAX_NOME) == 0;
+        }
+        if (!repetido)
+        {
+            indice->tabela[posicao] = (hash << 32) | (unsigned int)(id + 1);
+        }
+    }
+
+    mapaOrdenacao = mapa;
+    qsort(indice->ordenados, quantidade, sizeof(int), compararIds);
+    mapaOrdenacao = NULL;
+    return 0;
+}
+
+// ============================================================================
+// FUNÇÃO: buscarNome
+// DESCRIÇÃO: Procura um território pelo nome exato (sem diferenciar maiúsculas)
+// PARÂMETROS: indice, nome
+// RETORNO: ID do território ou -1 se não houver
+// ============================================================================
+int buscarNome(const IndiceNomes *indice, const char *nome)
+{
+    if (indice->tabela == NULL)
+    {
+        return -1;
+    }
+
+    unsigned long long hash = hashNome(nome, 0);
+    unsigned int posicao = (unsigned int)(hash >> 32) & indice->mascara;
+    for (; indice->tabela[posicao] != 0; posicao = (posicao + 1) & indice->mascara)
+    {
+        unsigned long long entrada = indice->tabela[posicao];
+        int id = (int)(entrada & 0xFFFFFFFFu) - 1;
+        if ((entrada >> 32) == (hash & 0xFFFFFFFFu) &&
+            compararNomes(indice->mapa[id].nome, nome, MAX_NOME) == 0)
+        {
+            return id;
+        }
+    }
+    return -1;
+}
+
+// ============================================================================
+// FUNÇÃO: buscarPrefixo
+// DESCRIÇÃO: Delimita os territórios cujo nome começa com o prefixo
+// PARÂMETROS: indice, prefixo
+//             primeiro (saída: posição do primeiro em indice->ordenados)
+// RETORNO: quantidade de territórios encontrados (ficam em sequência em
+//          indice->ordenados a partir de *primeiro)
+// ============================================================================
+int buscarPrefixo(const IndiceNomes *indice, const char *prefixo, int *primeiro)
+{
+    size_t tamanho = strlen(prefixo);
+
+    // Primeiro nome >= prefixo
+    int inicio = 0;
+    int fim = indice->quantidade;
+    while (inicio < fim)
+    {
+        int meio = inicio + (fim - inicio) / 2;
+        if (compararNomes(indice->mapa[indice->ordenados[meio]].nome, prefixo, tamanho) < 0)
+        {
+            inicio = meio + 1;
+        }
+        else
+        {
+            fim = meio;
+        }
+    }
+    *primeiro = inicio;
+
+    // Primeiro nome que já não começa com o prefixo
+    fim = indice->quantidade;
+    while (inicio < fim)
+    {
+        int meio = inicio + (fim - inicio) / 2;
+        if (compararNomes(indice->mapa[indice->ordenados[meio]].nome, prefixo, tamanho) <= 0)
+        {
+            inicio = meio + 1;
+        }
+        else
+        {
+            fim = meio;
+        }
+    }
+    return inicio - *primeiro;
+}
+
+// ============================================================================
+// FUNÇÃO: resolverTerritorio
+// DESCRIÇÃO: Interpreta o que o jogador digitou: um ID, um nome exato ou o
+//            começo de um único nome. Espaços nas pontas são ignorados.
+// PARÂMETROS: indice, texto, id (saída: território escolhido ou -1)
+// RETORNO: territórios que combinam com o texto (1 = escolha feita; 0 =
+//          nenhum; mais de 1 = ambíguo)
+// ============================================================================
+int resolverTerritorio(const IndiceNomes *indice, const char *texto, int *id)
+{
+    char nome[MAX_NOME];
+    size_t tamanho = apararTexto(texto, nome);
+    *id = -1;
+    if (tamanho == 0)
+    {
+        return 0;
+    }
+
+    // Só dígitos: é o ID, como no selecionarTerritorio
+    if (strspn(nome, "0123456789") == tamanho)
+    {
+        long numero = strtol(nome, NULL, 10);
+        if (numero < indice->quantidade)
+        {
+            *id = (int)numero;
+            return 1;
+        }
+        return 0;
+    }
+
+    *id = buscarNome(indice, nome);
+    if (*id >= 0)
+    {
+        return 1;
+    }
+
+    int primeiro;
+    int encontrados = buscarPrefixo(indice, nome, &primeiro);
+    if (encontrados == 1)
+    {
+        *id = indice->ordenados[primeiro];
+    }
+    return encontrados;
+}
+
+// ============================================================================
+// FUNÇÃO: escolherOuAvisar
+// DESCRIÇÃO: Resolve o texto e, se não houver uma escolha única, explica
+//            ao jogador (listando alguns nomes quando for ambíguo)
+// RETORNO: ID do território ou -1
+// ============================================================================
+static int escolherOuAvisar(const IndiceNomes *indice, const char *texto)
+{
+    int id;
+    int encontrados = resolverTerritorio(indice, texto, &id);
+    if (encontrados == 1)
+    {
+        return id;
+    }
+
+    char prefixo[MAX_NOME];
+    apararTexto(texto, prefixo);
+    if (encontrados == 0)
+    {
+        printf("❌ Nenhum território corresponde a \"%s\".\n", prefixo);
+        return -1;
+    }
+
+    int primeiro;
+    buscarPrefixo(indice, prefixo, &primeiro);
+    printf("⚠️  \"%s\" corresponde a %d territórios:\n", prefixo, encontrados);
+    for (int i = 0; i < encontrados && i < MAX_SUGESTOES; i++)
+    {
+        int sugestao = indice->ordenados[primeiro + i];
+        printf("   • [%d] %s\n", sugestao, indice->mapa[sugestao].nome);
+    }
+    if (encontrados > MAX_SUGESTOES)
+    {
+        printf("   • ... e mais %d\n", encontrados - MAX_SUGESTOES);
+    }
+    return -1;
+}
+
+// ============================================================================
+// FUNÇÃO: selecionarTerritorioPorNome
+// DESCRIÇÃO: Pede um território pelo ID, pelo nome ou pelo começo do nome,
+//            repetindo até haver uma escolha única. Com "segundo", aceita
+//            também os dois territórios de uma vez: "Brasil -> Argentina".
+// PARÂMETROS: indice, mensagem (texto exibido ao solicitar)
+//             segundo (saída opcional: território depois de "->", ou -1)
+// RETORNO: ID do território escolhido, ou -1 se a entrada terminar
+// ============================================================================
+int selecionarTerritorioPorNome(const IndiceNomes *indice, const char *mensagem, int *segundo)
+{
+    char linha[MAX_LINHA_COMANDO];
+
+    if (segundo != NULL)
+    {
+        *segundo = -1;
+    }
+
+    while (1)
+    {
+        printf("%s", mensagem);
+        if (fgets(linha, sizeof(linha), stdin) == NULL)
+        {
+            return -1;
+        }
+
+        char *seta = (segundo != NULL) ? strstr(linha, "->") : NULL;
+        if (seta == NULL)
+        {
+            int id = escolherOuAvisar(indice, linha);
+            if (id >= 0)
+            {
+                return id;
+            }
+            continue;
+        }
+
+        *seta = '\0';
+        int primeiro = escolherOuAvisar(indice, linha);
+        int outro = escolherOuAvisar(indice, seta + 2);
+        if (primeiro >= 0 && outro >= 0)
+        {
+            *segundo = outro;
+            return primeiro;
+        }
+    }
+}
+
+// ============================================================================
+// FUNÇÃO: liberarIndiceNomes
+// DESCRIÇÃO: Libera a memória do índice (o mapa não é liberado)
+// PARÂMETROS: indice
+// ============================================================================
+void liberarIndiceNomes(IndiceNomes *indice)
+{
+    liberarDe(indice->arena, indice->tabela);
+    liberarDe(indice->arena, indice->ordenados);
+    memset(indice, 0, sizeof(IndiceNomes));
+}
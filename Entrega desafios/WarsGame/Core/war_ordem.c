@@ -0,0 +1,441 @@
+// NÚCLEO DO JOGO DE GUERRA - ORDEM DOS TERRITÓRIOS NA MEMÓRIA
+//
+// OBJETIVO:
+// Em mapas grandes com fronteiras, territórios vizinhos (os que se atacam)
+// costumam estar longe um do outro no vetor do mapa: cada ataque lê duas
+// linhas de cache sem relação e a varredura dos vizinhos pula pela memória.
+// Esta passagem opcional renumera os territórios pela ordem Cuthill-McKee
+// reversa (RCM) do grafo de vizinhança: uma busca em largura que visita
+// primeiro os vizinhos de menor grau, invertida no final. Vizinhos passam a
+// ter posições próximas. O ID externo (o do cadastro) continua valendo por
+// meio de OrdemTerritorios, para jogadores, arquivos e visualizadores.
+//
+// O núcleo não tem coordenadas, então a curva de Hilbert não se aplica; a
+// vizinhança vem de pares de territórios (fronteiras ou ataques observados).
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "war_core.h"
+
+// ============================================================================
+// FUNÇÃO: calcularOrdemPorVizinhos
+// DESCRIÇÃO: Calcula a ordem RCM dos territórios. Cada componente do grafo
+//            começa pelo território de menor grau ainda não visitado.
+// PARÂMETROS: ordem (saída), quantidade (territórios)
+//             pares (quantidadePares pares de IDs externos vizinhos:
+//             pares[2k] e pares[2k + 1]; pares inválidos são ignorados)
+// RETORNO: 0 em caso de sucesso, 1 se faltar memória
+// ============================================================================
+int calcularOrdemPorVizinhos(OrdemTerritorios *ordem, int quantidade, const int *pares, int quantidadePares)
+{
+    memset(ordem, 0, sizeof(OrdemTerritorios));
+
+    int *inicio = (int *)calloc((size_t)quantidade + 1, sizeof(int));
+    int *vizinhos = (int *)malloc(((size_t)quantidadePares * 2 + 1) * sizeof(int));
+    int *porGrau = (int *)malloc(((size_t)quantidade + 1) * sizeof(int));
+    ordem->interno = (int *)malloc(((size_t)quantidade + 1) * sizeof(int));
+    ordem->externo = (int *)malloc(((size_t)quantidade + 1) * sizeof(int));
+    if (inicio == NULL || vizinhos == NULL || porGrau == NULL ||
+        ordem->interno == NULL || ordem->externo == NULL)
+    {
+        free(inicio);
+        free(vizinhos);
+        free(porGrau);
+        liberarOrdem(ordem);
+        return 1;
+    }
+    ordem->quantidade = quantidade;
+
+    // Lista de vizinhos compacta (CSR): os de t ficam em inicio[t]..inicio[t + 1]
+    for (int k = 0; k < quantidadePares; k++)
+    {
+        int a = pares[2 * k];
+        int b = pares[2 * k + 1];
+        if (a >= 0 && a < quantidade && b >= 0 && b < quantidade && a != b)
+        {
+            inicio[a + 1]++;
+            inicio[b + 1]++;
+        }
+    }
+    int maiorGrau = 0;
+    for (int t = 0; t < quantidade; t++)
+    {
+        maiorGrau = (inicio[t + 1] > maiorGrau) ? inicio[t + 1] : maiorGrau;
+        inicio[t + 1] += inicio[t];
+    }
+
+    int *proximo = ordem->interno; // Emprestado até a busca começar
+    memcpy(proximo, inicio, (size_t)quantidade * sizeof(int));
+    for (int k = 0; k < quantidadePares; k++)
+    {
+        int a = pares[2 * k];
+        int b = pares[2 * k + 1];
+        if (a >= 0 && a < quantidade && b >= 0 && b < quantidade && a != b)
+        {
+            vizinhos[proximo[a]++] = b;
+            vizinhos[proximo[b]++] = a;
+        }
+    }
+
+    // Territórios em ordem crescente de grau (contagem), para escolher as raízes
+    int *contagem = (int *)calloc((size_t)maiorGrau + 2, sizeof(int));
+    if (contagem == NULL)
+    {
+        free(inicio);
+        free(vizinhos);
+        free(porGrau);
+        liberarOrdem(ordem);
+        return 1;
+    }
+    for (int t = 0; t < quantidade; t++)
+    {
+        contagem[inicio[t + 1] - inicio[t] + 1]++;
+    }
+    for (int g = 0; g <= maiorGrau; g++)
+    {
+        contagem[g + 1] += contagem[g];
+    }
+    for (int t = 0; t < quantidade; t++)
+    {
+        porGrau[contagem[inicio[t + 1] - inicio[t]]++] = t;
+    }
+    free(contagem);
+
+    // Busca em largura; a fila é o próprio vetor externo
+    for (int t = 0; t < quantidade; t++)
+    {
+        ordem->interno[t] = -1;
+    }
+    int cabeca = 0;
+    int cauda = 0;
+    for (int r = 0; r < quantidade; r++)
+    {
+        int raiz = porGrau[r];
+        if (ordem->interno[raiz] >= 0)
+        {
+            continue;
+        }
+        ordem->interno[raiz] = cauda;
+        ordem->externo[cauda++] = raiz;
+
+        while (cabeca < cauda)
+        {
+            int atual = ordem->externo[cabeca++];
+            int primeiroNovo = cauda;
+            for (int v = inicio[atual]; v < inicio[atual + 1]; v++)
+            {
+                int vizinho = vizinhos[v];
+                if (ordem->interno[vizinho] < 0)
+                {
+                    ordem->interno[vizinho] = cauda;
+                    ordem->externo[cauda++] = vizinho;
+                }
+            }
+
+            // Vizinhos recém-descobertos em ordem crescente de grau (inserção)
+            for (int i = primeiroNovo + 1; i < cauda; i++)
+            {
+                int territorio = ordem->externo[i];
+                int grau = inicio[territorio + 1] - inicio[territorio];
+                int j = i;
+                for (; j > primeiroNovo &&
+                       inicio[ordem->externo[j - 1] + 1] - inicio[ordem->externo[j - 1]] > grau;
+                     j--)
+                {
+                    ordem->externo[j] = ordem->externo[j - 1];
+                }
+                ordem->externo[j] = territorio;
+            }
+        }
+    }
+
+    // Cuthill-McKee invertido
+    for (int i = 0; i < quantidade; i++)
+    {
+        ordem->interno[ordem->externo[quantidade - 1 - i]] = i;
+    }
+    for (int t = 0; t < quantidade; t++)
+    {
+        ordem->externo[ordem->interno[t]] = t;
+    }
+
+    free(inicio);
+    free(vizinhos);
+    free(porGrau);
+    return 0;
+}
+
+// ============================================================================
+// FUNÇÃO: aplicarOrdem
+// DESCRIÇÃO: Move os territórios do mapa (na ordem do cadastro) para as
+//            posições da nova ordem, seguindo os ciclos da permutação
+// PARÂMETROS: ordem, mapa (ordem->quantidade territórios)
+// RETORNO: 0 em caso de sucesso, 1 se faltar memória
+// ============================================================================
+int aplicarOrdem(const OrdemTerritorios *ordem, Territorio *mapa)
+{
+    unsigned char *movido = (unsigned char *)calloc((size_t)ordem->quantidade + 1, 1);
+    if (movido == NULL)
+    {
+        return 1;
+    }
+
+    for (int inicio = 0; inicio < ordem->quantidade; inicio++)
+    {
+        if (movido[inicio])
+        {
+            continue;
+        }
+
+        // A posição p recebe o território externo[p]; o ciclo volta ao início
+        Territorio guardado = mapa[inicio];
+        int posicao = inicio;
+        while (ordem->externo[posicao] != inicio)
+        {
+            mapa[posicao] = mapa[ordem->externo[posicao]];
+            movido[posicao] = 1;
+            posicao = ordem->externo[posicao];
+        }
+        mapa[posicao] = guardado;
+        movido[posicao] = 1;
+    }
+
+    free(movido);
+    return 0;
+}
+
+// ============================================================================
+// FUNÇÃO: liberarOrdem
+// DESCRIÇÃO: Libera os vetores de uma ordem
+// PARÂMETROS: ordem
+// ============================================================================
+void liberarOrdem(OrdemTerritorios *ordem)
+{
+    free(ordem->interno);
+    free(ordem->externo);
+    memset(ordem, 0, sizeof(OrdemTerritorios));
+}
+
+// ============================================================================
+// FUNÇÃO: distanciaMediaVizinhos
+// DESCRIÇÃO: Distância média, em posições do vetor, entre territórios vizinhos
+// PARÂMETROS: pares, quantidadePares, interno (posição de cada ID externo, ou
+//             NULL para a ordem do cadastro)
+// ============================================================================
+static double distanciaMediaVizinhos(const int *pares, int quantidadePares, const int *interno)
+{
+    double soma = 0.0;
+    for (int k = 0; k < quantidadePares; k++)
+    {
+        int a = interno != NULL ? interno[pares[2 * k]] : pares[2 * k];
+        int b = interno != NULL ? interno[pares[2 * k + 1]] : pares[2 * k + 1];
+        soma += (a > b) ? a - b : b - a;
+    }
+    return quantidadePares > 0 ? soma / quantidadePares : 0.0;
+}
+
+// ============================================================================
+// FUNÇÃO: compararPares
+// DESCRIÇÃO: Ordem dos pares de territórios pela posição do primeiro (qsort)
+// ============================================================================
+static int compararPares(const void *a, const void *b)
+{
+    const int *x = (const int *)a;
+    const int *y = (const int *)b;
+    if (x[0] != y[0])
+    {
+        return (x[0] > y[0]) - (x[0] < y[0]);
+    }
+    return (x[1] > y[1]) - (x[1] < y[1]);
+}
+
+// ============================================================================
+// FUNÇÃO: medirAtaquesVizinhos
+// DESCRIÇÃO: Aplica os ataques (pares de posições) e varre as fronteiras na
+//            ordem do vetor (cada território e seus vizinhos)
+// PARÂMETROS: mapa, ataques / quantidadeAtaques
+//             fronteiras / quantidadeFronteiras (reordenadas aqui)
+//             segundosAtaques / segundosVarredura (saídas)
+// RETORNO: soma das tropas vistas na varredura (evita que ela seja eliminada)
+// ============================================================================
+static long long medirAtaquesVizinhos(Territorio *mapa, const int *ataques, int quantidadeAtaques,
+                                      int *fronteiras, int quantidadeFronteiras,
+                                      double *segundosAtaques, double *segundosVarredura)
+{
+    semearAleatorio(2);
+    double inicio = agoraSegundos();
+    for (int k = 0; k < quantidadeAtaques; k++)
+    {
+        resolverAtaque(&mapa[ataques[2 * k]], &mapa[ataques[2 * k + 1]]);
+    }
+    *segundosAtaques = agoraSegundos() - inicio;
+
+    qsort(fronteiras, quantidadeFronteiras, 2 * sizeof(int), compararPares);
+    long long soma = 0;
+    inicio = agoraSegundos();
+    for (int k = 0; k < quantidadeFronteiras; k++)
+    {
+        soma += mapa[fronteiras[2 * k]].tropas + mapa[fronteiras[2 * k + 1]].tropas;
+    }
+    *segundosVarredura = agoraSegundos() - inicio;
+    return soma;
+}
+
+// ============================================================================
+// FUNÇÃO: compararOrdemTerritorios
+// DESCRIÇÃO: Mede o ganho da ordem RCM em um mapa em grade (lado x lado, 4
+//            vizinhos por território) cadastrado em ordem aleatória, como
+//            acontece quando os IDs não seguem a geografia: a mesma
+//            sequência de ataques entre vizinhos (em campanhas que avançam
+//            pela grade) e uma varredura das fronteiras, nas duas ordens
+//            (os estados finais precisam coincidir)
+// PARÂMETROS: lado (territórios por lado da grade), ataques (quantidade)
+// RETORNO: 0 em caso de sucesso, 1 em caso de falha
+// ============================================================================
+int compararOrdemTerritorios(int lado, int ataques)
+{
+    int quantidade = lado * lado;
+    int quantidadeFronteiras = 2 * lado * (lado - 1);
+    OrdemTerritorios ordem;
+
+    int *rotulo = (int *)malloc((size_t)quantidade * sizeof(int));
+    int *fronteiras = (int *)malloc((size_t)quantidadeFronteiras * 2 * sizeof(int));
+    int *pares = (int *)malloc((size_t)ataques * 2 * sizeof(int));
+    Territorio *mapa = (Territorio *)calloc(quantidade, sizeof(Territorio));
+    Territorio *reordenado = (Territorio *)malloc((size_t)quantidade * sizeof(Territorio));
+    if (rotulo == NULL || fronteiras == NULL || pares == NULL || mapa == NULL || reordenado == NULL)
+    {
+        printf("❌ Erro: Falha na alocação de memória para o mapa!\n");
+        free(rotulo);
+        free(fronteiras);
+        free(pares);
+        free(mapa);
+        free(reordenado);
+        return 1;
+    }
+
+    // ID externo de cada casa da grade, embaralhado (Fisher-Yates)
+    semearAleatorio(1);
+    for (int c = 0; c < quantidade; c++)
+    {
+        rotulo[c] = c;
+    }
+    for (int c = quantidade - 1; c > 0; c--)
+    {
+        int outra = (int)(proximoAleatorio() % (unsigned int)(c + 1));
+        int troca = rotulo[c];
+        rotulo[c] = rotulo[outra];
+        rotulo[outra] = troca;
+    }
+
+    int f = 0;
+    for (int linha = 0; linha < lado; linha++)
+    {
+        for (int coluna = 0; coluna < lado; coluna++)
+        {
+            int casa = linha * lado + coluna;
+            if (coluna + 1 < lado)
+            {
+                fronteiras[f++] = rotulo[casa];
+                fronteiras[f++] = rotulo[casa + 1];
+            }
+            if (linha + 1 < lado)
+            {
+                fronteiras[f++] = rotulo[casa];
+                fronteiras[f++] = rotulo[casa + lado];
+            }
+        }
+    }
+
+    // Ataques em campanhas: cada um parte de uma casa vizinha do anterior
+    // (a frente avança pela grade); 1 em 8 recomeça em uma casa qualquer
+    int casa = 0;
+    for (int k = 0; k < ataques; k++)
+    {
+        if ((proximoAleatorio() & 7) == 0)
+        {
+            casa = (int)(proximoAleatorio() % (unsigned int)quantidade);
+        }
+
+        int alvo;
+        do
+        {
+            static const int passos[4][2] = {{0, 1}, {0, -1}, {1, 0}, {-1, 0}};
+            const int *passo = passos[proximoAleatorio() & 3];
+            int linha = casa / lado + passo[0];
+            int coluna = casa % lado + passo[1];
+            alvo = (linha >= 0 && linha < lado && coluna >= 0 && coluna < lado) ? linha * lado + coluna : -1;
+        } while (alvo < 0);
+
+        pares[2 * k] = rotulo[casa];
+        pares[2 * k + 1] = rotulo[alvo];
+        casa = alvo;
+    }
+
+    gerarMapaAleatorio(mapa, quantidade, 4);
+    memcpy(reordenado, mapa, (size_t)quantidade * sizeof(Territorio));
+
+    double inicio = agoraSegundos();
+    if (calcularOrdemPorVizinhos(&ordem, quantidade, fronteiras, quantidadeFronteiras) != 0 ||
+        aplicarOrdem(&ordem, reordenado) != 0)
+    {
+        printf("❌ Erro: Falha na alocação de memória para a ordem!\n");
+        liberarOrdem(&ordem);
+        free(rotulo);
+        free(fronteiras);
+        free(pares);
+        free(mapa);
+        free(reordenado);
+        return 1;
+    }
+    double tempoOrdem = agoraSegundos() - inicio;
+
+    printf("Grade: %d x %d (%d territórios, %.1f MB) | Ataques: %d\n\n",
+           lado, lado, quantidade, (double)quantidade * sizeof(Territorio) / 1e6, ataques);
+    printf("%-34s %14s %14s\n", "", "Cadastro", "RCM");
+    printf("%-34s %14.1f %14.1f\n", "Distância média entre vizinhos",
+           distanciaMediaVizinhos(fronteiras, quantidadeFronteiras, NULL),
+           distanciaMediaVizinhos(fronteiras, quantidadeFronteiras, ordem.interno));
+
+    double ataquesCadastro, varreduraCadastro, ataquesRcm, varreduraRcm;
+    long long somaCadastro = medirAtaquesVizinhos(mapa, pares, ataques, fronteiras, quantidadeFronteiras,
+                                                  &ataquesCadastro, &varreduraCadastro);
+
+    // Mesmos ataques e fronteiras, traduzidos para as posições da nova ordem
+    for (int k = 0; k < 2 * ataques; k++)
+    {
+        pares[k] = ordem.interno[pares[k]];
+    }
+    for (int k = 0; k < 2 * quantidadeFronteiras; k++)
+    {
+        fronteiras[k] = ordem.interno[fronteiras[k]];
+    }
+    long long somaRcm = medirAtaquesVizinhos(reordenado, pares, ataques, fronteiras, quantidadeFronteiras,
+                                             &ataquesRcm, &varreduraRcm);
+
+    printf("%-34s %14.1f %14.1f\n", "Ataque (ns)",
+           ataquesCadastro * 1e9 / ataques, ataquesRcm * 1e9 / ataques);
+    printf("%-34s %14.2f %14.2f\n", "Varredura das fronteiras (ms)",
+           varreduraCadastro * 1e3, varreduraRcm * 1e3);
+    printf("\nCálculo e aplicação da ordem: %.1f ms\n", tempoOrdem * 1e3);
+
+    int iguais = somaCadastro == somaRcm;
+    for (int t = 0; t < quantidade && iguais; t++)
+    {
+        const Territorio *a = &mapa[t];
+        const Territorio *b = &reordenado[ordem.interno[t]];
+        iguais = a->dono == b->dono && a->tropas == b->tropas && strcmp(a->nome, b->nome) == 0;
+    }
+    printf(iguais ? "✅ Estados finais coincidem (pelo ID externo)\n"
+                  : "❌ Estados finais diferentes!\n");
+
+    liberarOrdem(&ordem);
+    free(rotulo);
+    free(fronteiras);
+    free(pares);
+    free(mapa);
+    free(reordenado);
+    return !iguais;
+}
@@ -0,0 +1,286 @@
+// NÚCLEO DO JOGO DE GUERRA - REGRAS RECARREGÁVEIS
+//
+// OBJETIVO:
+// Mudar as regras (faces dos dados, limites das missões) sem recompilar
+// nem parar as partidas em andamento:
+// - lerRegras() interpreta um arquivo "chave = valor" em uma VersaoRegras
+// - recarregarRegras() publica a versão nova trocando um único ponteiro
+// - fixarRegras()/soltarRegras() prendem uma versão a uma partida
+// Os turnos nunca consultam a versão publicada: cada partida usa o ponteiro
+// que fixou ao ser criada (usarRegras, por thread), e uma versão nunca é
+// alterada depois de publicada. Por isso uma recarga não espera nenhum
+// ataque terminar e nenhum ataque espera a recarga (a mesma ideia do RCU).
+// A trava curta abaixo só protege a contagem de fixações, usada ao criar e
+// ao liberar partidas; ela nunca é tomada durante um turno.
+//
+// As missões continuam as de missoesPredefinidas (o ID é a identidade da
+// missão em partidas, cenários e métricas); só os números que elas exigem
+// vêm do arquivo. Ver descreverMissao().
+
+#include <ctype.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "war_core.h"
+
+#define MAX_LINHA_REGRAS 256 // Linha mais longa aceita no arquivo de regras
+#define MAX_LIMITE_REGRAS 1000000 // Maior número de tropas ou territórios exigido por uma missão
+
+static _Atomic(VersaoRegras *) publicada = NULL;
+static atomic_uint numeroPublicado = 0; // Cópia de publicada->regras.versao para leitura sem trava
+static atomic_flag travaFixacoes = ATOMIC_FLAG_INIT;
+
+// ============================================================================
+// FUNÇÃO: travar / destravar
+// DESCRIÇÃO: Trava de espera ativa das fixações (seções de poucas instruções)
+// ============================================================================
+static void travar(void)
+{
+    while (atomic_flag_test_and_set_explicit(&travaFixacoes, memory_order_acquire))
+    {
+    }
+}
+
+static void destravar(void)
+{
+    atomic_flag_clear_explicit(&travaFixacoes, memory_order_release);
+}
+
+// ============================================================================
+// FUNÇÃO: aparar
+// DESCRIÇÃO: Remove espaços do começo e do fim de um texto (no lugar)
+// RETORNO: início do texto aparado
+// ============================================================================
+static char *aparar(char *texto)
+{
+    while (isspace((unsigned char)*texto))
+    {
+        texto++;
+    }
+    size_t tamanho = strlen(texto);
+    while (tamanho > 0 && isspace((unsigned char)texto[tamanho - 1]))
+    {
+        texto[--tamanho] = '\0';
+    }
+    return texto;
+}
+
+// ============================================================================
+// FUNÇÃO: lerInteiro
+// DESCRIÇÃO: Converte um valor do arquivo, aceitando só inteiros na faixa
+// PARÂMETROS: texto, minimo / maximo, valor (saída)
+// RETORNO: 0 em caso de sucesso, 1 se o valor for inválido
+// ============================================================================
+static int lerInteiro(const char *texto, int minimo, int maximo, int *valor)
+{
+    char *fim;
+    long lido = strtol(texto, &fim, 10);
+    if (fim == texto || *fim != '\0' || lido < minimo || lido > maximo)
+    {
+        return 1;
+    }
+    *valor = (int)lido;
+    return 0;
+}
+
+// ============================================================================
+// FUNÇÃO: lerRegras
+// DESCRIÇÃO: Lê um arquivo de regras. Cada linha é "chave = valor"; linhas
+//            vazias e o que vem depois de '#' são ignorados. Chaves:
+//            nivel, faces_dado, tropas_missao, territorios_seguidos e
+//            territorios_expansao. As ausentes vêm da versão publicada
+//            (ou das regras da thread, se nenhuma foi publicada ainda).
+// PARÂMETROS: caminho (arquivo), versao (saída; versao->regras.versao = 0)
+//             linhaErro (saída: linha inválida, 0 se o erro não for de linha)
+// RETORNO: 0 em caso de sucesso, 1 se o arquivo não abrir, 2 se for inválido
+// ============================================================================
+int lerRegras(const char *caminho, VersaoRegras *versao, int *linhaErro)
+{
+    *linhaErro = 0;
+    FILE *arquivo = fopen(caminho, "r");
+    if (arquivo == NULL)
+    {
+        return 1;
+    }
+
+    // Fixada enquanto é copiada: uma recarga concorrente não a libera no meio
+    const RegrasJogo *base = fixarRegras();
+    memset(versao, 0, sizeof(VersaoRegras));
+    versao->regras = *base;
+    versao->regras.versao = 0;
+    snprintf(versao->nivel, sizeof(versao->nivel), "%s", base->nivel);
+    soltarRegras(base);
+
+    char linha[MAX_LINHA_REGRAS];
+    int numero = 0;
+    int erro = 0;
+    while (!erro && fgets(linha, sizeof(linha), arquivo) != NULL)
+    {
+        numero++;
+        if (strchr(linha, '\n') == NULL && !feof(arquivo))
+        {
+            erro = 1; // Linha longa demais
+            break;
+        }
+
+        char *comentario = strchr(linha, '#');
+        if (comentario != NULL)
+        {
+            *comentario = '\0';
+        }
+        char *chave = aparar(linha);
+        if (*chave == '\0')
+        {
+            continue;
+        }
+
+        char *igual = strchr(chave, '=');
+        if (igual == NULL)
+        {
+            erro = 1;
+            break;
+        }
+        *igual = '\0';
+        char *valor = aparar(igual + 1);
+        chave = aparar(chave);
+
+        RegrasJogo *lidas = &versao->regras;
+        if (strcmp(chave, "nivel") == 0)
+        {
+            erro = (*valor == '\0' || strlen(valor) >= sizeof(versao->nivel));
+            if (!erro)
+            {
+                strcpy(versao->nivel, valor);
+            }
+        }
+        else if (strcmp(chave, "faces_dado") == 0)
+        {
+            erro = lerInteiro(valor, 2, MAX_FACES_ESTATISTICA, &lidas->facesDado);
+        }
+        else if (strcmp(chave, "tropas_missao") == 0)
+        {
+            erro = lerInteiro(valor, 1, MAX_LIMITE_REGRAS, &lidas->tropasMissao);
+        }
+        else if (strcmp(chave, "territorios_seguidos") == 0)
+        {
+            erro = lerInteiro(valor, 1, MAX_LIMITE_REGRAS, &lidas->territoriosSeguidos);
+        }
+        else if (strcmp(chave, "territorios_expansao") == 0)
+        {
+            erro = lerInteiro(valor, 1, MAX_LIMITE_REGRAS, &lidas->territoriosExpansao);
+        }
+        else
+        {
+            erro = 1; // Chave desconhecida: melhor recusar que ignorar um erro de digitação
+        }
+    }
+    fclose(arquivo);
+
+    if (erro)
+    {
+        *linhaErro = numero;
+        return 2;
+    }
+    versao->regras.nivel = versao->nivel;
+    return 0;
+}
+
+// ============================================================================
+// FUNÇÃO: soltarVersao
+// DESCRIÇÃO: Tira uma fixação de uma versão (com a trava tomada) e a libera
+//            se foi a última
+// ============================================================================
+static void soltarVersao(VersaoRegras *versao)
+{
+    if (--versao->fixacoes == 0)
+    {
+        free(versao);
+    }
+}
+
+// ============================================================================
+// FUNÇÃO: recarregarRegras
+// DESCRIÇÃO: Lê o arquivo e publica as regras como uma versão nova. A
+//            leitura acontece fora da trava; a troca é um único ponteiro.
+//            Partidas já criadas continuam na versão que fixaram.
+// PARÂMETROS: caminho (arquivo de regras), linhaErro (ver lerRegras)
+// RETORNO: 0 em caso de sucesso, 1 se o arquivo não abrir ou faltar
+//          memória, 2 se o arquivo for inválido (nada é publicado)
+// ============================================================================
+int recarregarRegras(const char *caminho, int *linhaErro)
+{
+    VersaoRegras *nova = (VersaoRegras *)malloc(sizeof(VersaoRegras));
+    if (nova == NULL)
+    {
+        *linhaErro = 0;
+        return 1;
+    }
+
+    int erro = lerRegras(caminho, nova, linhaErro);
+    if (erro != 0)
+    {
+        free(nova);
+        return erro;
+    }
+    nova->fixacoes = 1; // A fixação da própria publicação
+
+    travar();
+    VersaoRegras *anterior = atomic_load_explicit(&publicada, memory_order_relaxed);
+    nova->regras.versao = (anterior != NULL) ? anterior->regras.versao + 1 : 1;
+    atomic_store_explicit(&publicada, nova, memory_order_release);
+    atomic_store_explicit(&numeroPublicado, nova->regras.versao, memory_order_relaxed);
+    if (anterior != NULL)
+    {
+        soltarVersao(anterior);
+    }
+    destravar();
+    return 0;
+}
+
+// ============================================================================
+// FUNÇÃO: fixarRegras
+// DESCRIÇÃO: Prende a versão publicada a uma partida que está começando.
+//            Sem nenhuma publicada, devolve as regras em uso na thread.
+// RETORNO: regras a usar durante toda a partida (soltar com soltarRegras)
+// ============================================================================
+const RegrasJogo *fixarRegras(void)
+{
+    travar();
+    VersaoRegras *atual = atomic_load_explicit(&publicada, memory_order_relaxed);
+    if (atual != NULL)
+    {
+        atual->fixacoes++;
+    }
+    destravar();
+
+    return (atual != NULL) ? &atual->regras : regras;
+}
+
+// ============================================================================
+// FUNÇÃO: soltarRegras
+// DESCRIÇÃO: Devolve a fixação de uma partida que terminou
+// PARÂMETROS: fixadas (retorno de fixarRegras; as embutidas são ignoradas)
+// ============================================================================
+void soltarRegras(const RegrasJogo *fixadas)
+{
+    if (fixadas == NULL || fixadas->versao == 0)
+    {
+        return;
+    }
+
+    travar();
+    soltarVersao((VersaoRegras *)fixadas);
+    destravar();
+}
+
+// ============================================================================
+// FUNÇÃO: versaoPublicada
+// DESCRIÇÃO: Número da versão publicada, sem tomar a trava
+// RETORNO: versão (0 se o arquivo de regras nunca foi carregado)
+// ============================================================================
+unsigned int versaoPublicada(void)
+{
+    return atomic_load_explicit(&numeroPublicado, memory_order_relaxed);
+}
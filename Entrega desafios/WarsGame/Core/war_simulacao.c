@@ -0,0 +1,580 @@
+// NÚCLEO DO JOGO DE GUERRA - SIMULAÇÃO E VERIFICAÇÃO DE REGRAS
+//
+// OBJETIVO:
+// Jogar partidas sem interação a partir de uma semente e conferir as
+// propriedades das regras sobre sequências aleatórias de ações.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "war_core.h"
+
+#define MAX_LINHA_CORPUS 128 // Linha mais longa de um caso do corpus
+
+// ============================================================================
+// CORES USADAS NAS PARTIDAS SIMULADAS
+// Cada jogador simulado recebe uma cor deste vetor, na ordem
+// ============================================================================
+const char *coresSimulacao[] = {"azul", "vermelho", "verde", "amarelo", "preto", "branco"};
+
+// ============================================================================
+// CORES USADAS NA VERIFICAÇÃO DE REGRAS
+// Inclui grafias diferentes de vermelho para exercitar o registro de cores
+// ============================================================================
+const char *coresVerificacao[] = {"vermelho", "Vermelho", "vermelha", "Vermelha",
+                                  "VERMELHO", " vermelho", "azul", "verde"};
+
+// ============================================================================
+// PROPRIEDADES VERIFICADAS
+// Invariantes das regras checados após cada ação da verificação de regras
+// ============================================================================
+const char *propriedadesRegras[] = {
+    "tropas nunca ficam negativas",
+    "o dono só muda quando o atacante vence",
+    "a conquista deixa metade das tropas do defensor",
+    "a derrota custa exatamente 1 tropa ao atacante",
+    "ataque inválido ou empate não altera o mapa",
+    "missão vermelha reconhece qualquer grafia de vermelho",
+    "desfazer e refazer reproduzem o mapa exato"};
+
+// ============================================================================
+// FUNÇÃO: gerarMapaAleatorio
+// DESCRIÇÃO: Preenche o mapa sem interação com o usuário, distribuindo os
+//            territórios entre as cores dos jogadores e sorteando as tropas
+// PARÂMETROS: mapa (array de territórios já alocado)
+//             quantidade (quantidade de territórios)
+//             quantidadeJogadores (quantidade de cores em jogo)
+// ============================================================================
+void gerarMapaAleatorio(Territorio *mapa, int quantidade, int quantidadeJogadores)
+{
+    int donos[TOTAL_CORES_SIMULACAO];
+    for (int j = 0; j < quantidadeJogadores; j++)
+    {
+        donos[j] = idCor(coresSimulacao[j]);
+    }
+
+    for (int i = 0; i < quantidade; i++)
+    {
+        snprintf(mapa[i].nome, MAX_NOME, "Territorio %d", i);
+        mapa[i].dono = donos[i % quantidadeJogadores];
+        mapa[i].tropas = (int)(proximoAleatorio() % 10) + 1;
+
+        mapa[i].donoInicial = mapa[i].dono;
+        mapa[i].tropasInicial = mapa[i].tropas;
+    }
+}
+
+// ============================================================================
+// FUNÇÃO: simularPartida
+// DESCRIÇÃO: Joga uma partida completa sem interação: a cada turno sorteia
+//            atacante e defensor, resolve o ataque e verifica as missões.
+//            A partida depende apenas da semente, então pode ser repetida.
+// PARÂMETROS: semente (identifica e reproduz a partida)
+//             quantidadeTerritorios / quantidadeJogadores (tamanho do jogo)
+//             turnos (saída: turnos jogados)
+//             missaoVencedora (saída: índice da missão cumprida, -1 se nenhuma)
+// RETORNO: índice do jogador vencedor, -1 se ninguém venceu no limite de
+//          turnos, ou -2 em caso de falha de alocação
+// ============================================================================
+int simularPartida(unsigned long long semente, int quantidadeTerritorios,
+                   int quantidadeJogadores, int *turnos, int *missaoVencedora)
+{
+    *turnos = 0;
+    *missaoVencedora = -1;
+
+    Territorio *mapa = (Territorio *)calloc(quantidadeTerritorios, sizeof(Territorio));
+    int missoes[TOTAL_CORES_SIMULACAO];
+    int donos[TOTAL_CORES_SIMULACAO];
+    if (mapa == NULL)
+    {
+        return -2;
+    }
+
+    metricas.partidasAtivas++;
+    semearAleatorio(semente);
+    gerarMapaAleatorio(mapa, quantidadeTerritorios, quantidadeJogadores);
+
+    // Missões sorteadas sem repetição (IDs em missoesPredefinidas)
+    for (int i = 0; i < quantidadeJogadores; i++)
+    {
+        donos[i] = idCor(coresSimulacao[i]);
+    }
+    SorteioMissoes sorteio;
+    iniciarSorteioMissoes(&sorteio, quantidadeTerritorios);
+    sortearMissoesJogadores(&sorteio, NULL, mapa, quantidadeTerritorios, donos, missoes, quantidadeJogadores);
+
+    int vencedor = -1;
+    while (vencedor == -1 && *turnos < MAX_TURNOS_SIMULACAO)
+    {
+        int idAtacante = (int)(proximoAleatorio() % quantidadeTerritorios);
+        int idDefensor = (int)(proximoAleatorio() % quantidadeTerritorios);
+        if (idAtacante == idDefensor)
+        {
+            continue;
+        }
+
+        resolverAtaque(&mapa[idAtacante], &mapa[idDefensor]);
+        (*turnos)++;
+
+        vencedor = verificarVencedor(missoes, donos, mapa, quantidadeJogadores, quantidadeTerritorios);
+    }
+
+    if (vencedor >= 0)
+    {
+        *missaoVencedora = missoes[vencedor];
+        metricas.missoesCumpridas[*missaoVencedora]++;
+    }
+    metricas.partidasAtivas--;
+
+    free(mapa);
+
+    return vencedor;
+}
+
+// ============================================================================
+// FUNÇÃO: simularPartidas
+// DESCRIÇÃO: Simula um intervalo de sementes e imprime um registro compacto
+//            por partida ("semente vencedor missao turnos"). Intervalos
+//            disjuntos podem rodar em processos separados (ver coordenador.sh)
+//            e o resultado de cada semente é sempre o mesmo.
+// PARÂMETROS: sementeInicial (primeira semente do intervalo)
+//             quantidadeJogos (quantas sementes simular)
+//             quantidadeTerritorios / quantidadeJogadores (tamanho do jogo)
+// RETORNO: 0 em caso de sucesso, 1 em caso de falha
+// ============================================================================
+int simularPartidas(unsigned long long sementeInicial, int quantidadeJogos,
+                    int quantidadeTerritorios, int quantidadeJogadores)
+{
+    for (int i = 0; i < quantidadeJogos; i++)
+    {
+        unsigned long long semente = sementeInicial + (unsigned long long)i;
+        int turnos = 0;
+        int missao = -1;
+
+        int vencedor = simularPartida(semente, quantidadeTerritorios, quantidadeJogadores,
+                                      &turnos, &missao);
+        if (vencedor == -2)
+        {
+            fprintf(stderr, "Erro: falha de alocação na semente %llu\n", semente);
+            return 1;
+        }
+
+        printf("%llu %d %d %d\n", semente, vencedor, missao, turnos);
+    }
+
+    return 0;
+}
+
+// ============================================================================
+// FUNÇÃO: medirDesempenho
+// DESCRIÇÃO: Carga de trabalho padrão para medir o motor do jogo: em um mapa
+//            grande, cada turno resolve um ataque entre territórios sorteados
+//            e verifica todas as missões pré-definidas do primeiro jogador
+//            (sem encerrar a partida). A medição é repetida e a melhor
+//            rodada é informada, para reduzir o ruído da máquina.
+// PARÂMETROS: semente (define mapa, ataques e dados)
+//             turnos (turnos por repetição)
+//             quantidadeTerritorios / quantidadeJogadores (tamanho do jogo)
+// RETORNO: nanossegundos por turno na melhor repetição (negativo em caso de falha)
+// ============================================================================
+double medirDesempenho(unsigned long long semente, long long turnos,
+                       int quantidadeTerritorios, int quantidadeJogadores)
+{
+    const int repeticoes = 3;
+    double melhor = -1.0;
+    long long cumpridas = 0;
+
+    Territorio *mapa = (Territorio *)calloc(quantidadeTerritorios, sizeof(Territorio));
+    if (mapa == NULL)
+    {
+        return -1.0;
+    }
+
+    for (int r = 0; r < repeticoes; r++)
+    {
+        semearAleatorio(semente);
+        gerarMapaAleatorio(mapa, quantidadeTerritorios, quantidadeJogadores);
+        int donoMedido = mapa[0].dono;
+
+        double inicio = agoraSegundos();
+        for (long long t = 0; t < turnos; t++)
+        {
+            int idAtacante = (int)(proximoAleatorio() % quantidadeTerritorios);
+            int idDefensor = (int)(proximoAleatorio() % quantidadeTerritorios);
+            resolverAtaque(&mapa[idAtacante], &mapa[idDefensor]);
+
+            for (int m = 0; m < TOTAL_MISSOES; m++)
+            {
+                cumpridas += verificarMissao(m, mapa, quantidadeTerritorios, donoMedido);
+            }
+        }
+        double nsPorTurno = (agoraSegundos() - inicio) * 1e9 / (double)turnos;
+
+        if (melhor < 0.0 || nsPorTurno < melhor)
+        {
+            melhor = nsPorTurno;
+        }
+    }
+
+    free(mapa);
+
+    // Usa o total para que o compilador não descarte as verificações
+    printf("Missões cumpridas (conferência): %lld\n", cumpridas);
+    return melhor;
+}
+
+// ============================================================================
+// FUNÇÃO: corEhVermelha
+// DESCRIÇÃO: Referência independente para "a cor é vermelha": ignora
+//            espaços nas pontas, maiúsculas/minúsculas e o gênero
+// PARÂMETROS: cor (nome digitado)
+// RETORNO: 1 se a cor for vermelha, 0 caso contrário
+// ============================================================================
+static int corEhVermelha(const char *cor)
+{
+    const char *referencia = "vermelh";
+    while (*cor == ' ')
+    {
+        cor++;
+    }
+
+    for (int i = 0; referencia[i] != '\0'; i++, cor++)
+    {
+        if (*cor == '\0' || (*cor | 0x20) != referencia[i])
+        {
+            return 0;
+        }
+    }
+
+    if ((*cor | 0x20) != 'o' && (*cor | 0x20) != 'a')
+    {
+        return 0;
+    }
+    cor++;
+
+    while (*cor == ' ')
+    {
+        cor++;
+    }
+    return *cor == '\0';
+}
+
+// ============================================================================
+// FUNÇÃO: mapasIguais
+// DESCRIÇÃO: Compara dono e tropas de dois mapas do mesmo tamanho
+// RETORNO: 1 se forem iguais, 0 caso contrário
+// ============================================================================
+static int mapasIguais(const Territorio *a, const Territorio *b, int quantidade)
+{
+    for (int i = 0; i < quantidade; i++)
+    {
+        if (a[i].tropas != b[i].tropas || a[i].dono != b[i].dono)
+        {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+// ============================================================================
+// FUNÇÃO: registrarFalhaRegra
+// DESCRIÇÃO: Conta uma violação e, na primeira vez de cada propriedade,
+//            exibe e grava no corpus o caso mínimo que a reproduz: a semente,
+//            o passo e o estado dos territórios envolvidos antes da ação
+// PARÂMETROS: falhas (contadores por propriedade), propriedade (índice)
+//             semente / passo (reproduzem a sequência até a falha)
+//             antesAtacante / antesDefensor (estado antes da ação)
+//             corpus (arquivo de casos, ou NULL)
+// ============================================================================
+static void registrarFalhaRegra(long long *falhas, int propriedade, unsigned long long semente,
+                                long long passo, const Territorio *antesAtacante,
+                                const Territorio *antesDefensor, FILE *corpus)
+{
+    if (falhas[propriedade]++ > 0)
+    {
+        return;
+    }
+
+    printf("❌ Violação: %s\n", propriedadesRegras[propriedade]);
+    printf("   Reproduzir: --verificar-regras %llu %lld\n", semente, passo + 1);
+    printf("   Atacante antes: [%s] %d tropas | Defensor antes: [%s] %d tropas\n",
+           tabelaCores[antesAtacante->dono], antesAtacante->tropas,
+           tabelaCores[antesDefensor->dono], antesDefensor->tropas);
+
+    if (corpus != NULL)
+    {
+        fprintf(corpus, "%llu %lld %d \"%s\" %d \"%s\" %d\n", semente, passo + 1, propriedade,
+                tabelaCores[antesAtacante->dono], antesAtacante->tropas,
+                tabelaCores[antesDefensor->dono], antesDefensor->tropas);
+    }
+}
+
+// ============================================================================
+// FUNÇÃO: conferirSequencia
+// DESCRIÇÃO: Executa uma sequência aleatória (mas reproduzível) de ações
+//            sobre um mapa pequeno — ataques entre pares quaisquer e troca
+//            da grafia das cores — e confere as propriedades das regras
+//            depois de cada ação. As ações vão para um diário e, a cada
+//            INTERVALO_DESFAZER ações, são todas desfeitas e refeitas.
+// NOTA: Cada território guarda só o ID da cor; a grafia sorteada fica em
+//       grafias[] para que a referência independente (corEhVermelha) confira
+//       o registro de cores
+// PARÂMETROS: semente (define toda a sequência), acoes (quantidade de ações)
+//             falhas (contadores por propriedade, acumulados)
+//             corpus (arquivo onde acrescentar os casos que falharam, ou NULL)
+//             ultimoAtacante / ultimoDefensor (saída: estado antes da última
+//             ação, o mesmo que o corpus grava)
+// RETORNO: 0 em caso de sucesso, 1 em caso de falha de alocação
+// ============================================================================
+static int conferirSequencia(unsigned long long semente, long long acoes, long long *falhas, FILE *corpus,
+                             Territorio *ultimoAtacante, Territorio *ultimoDefensor)
+{
+    Territorio mapa[TERRITORIOS_VERIFICACAO];
+    Territorio ultimoPonto[TERRITORIOS_VERIFICACAO];
+    Territorio atual[TERRITORIOS_VERIFICACAO];
+    const char *grafias[TERRITORIOS_VERIFICACAO];
+    DiarioAlteracoes diario;
+
+    if (iniciarDiario(&diario, 2 * INTERVALO_DESFAZER, NULL) != 0)
+    {
+        return 1;
+    }
+
+    semearAleatorio(semente);
+    for (int i = 0; i < TERRITORIOS_VERIFICACAO; i++)
+    {
+        snprintf(mapa[i].nome, MAX_NOME, "Territorio %d", i);
+        grafias[i] = coresVerificacao[proximoAleatorio() % TOTAL_CORES_VERIFICACAO];
+        mapa[i].dono = idCor(grafias[i]);
+        mapa[i].tropas = (int)(proximoAleatorio() % 13);
+        mapa[i].donoInicial = mapa[i].dono;
+        mapa[i].tropasInicial = mapa[i].tropas;
+    }
+    memcpy(ultimoPonto, mapa, sizeof(mapa));
+
+    for (long long passo = 0; passo < acoes; passo++)
+    {
+        int a = (int)(proximoAleatorio() % TERRITORIOS_VERIFICACAO);
+        int d = (int)(proximoAleatorio() % TERRITORIOS_VERIFICACAO);
+        Territorio antesAtacante = mapa[a];
+        Territorio antesDefensor = mapa[d];
+        *ultimoAtacante = antesAtacante;
+        *ultimoDefensor = antesDefensor;
+
+        // 1 em cada 16 ações troca a grafia da cor em vez de atacar
+        if (proximoAleatorio() % 16 == 0)
+        {
+            anotarAlteracao(&diario, mapa, d);
+            grafias[d] = coresVerificacao[proximoAleatorio() % TOTAL_CORES_VERIFICACAO];
+            mapa[d].dono = idCor(grafias[d]);
+            concluirAlteracoes(&diario, mapa);
+        }
+        else
+        {
+            ResultadoAtaque resultado = atacarComDiario(&diario, mapa, a, d);
+            if (resultado.tipo == ATAQUE_VITORIA)
+            {
+                grafias[d] = grafias[a];
+            }
+
+            if (mapa[a].tropas < 0 || mapa[d].tropas < 0)
+            {
+                registrarFalhaRegra(falhas, 0, semente, passo, &antesAtacante, &antesDefensor, corpus);
+            }
+
+            int donoMudou = antesDefensor.dono != mapa[d].dono ||
+                            (a != d && antesAtacante.dono != mapa[a].dono);
+            if (donoMudou && resultado.tipo != ATAQUE_VITORIA)
+            {
+                registrarFalhaRegra(falhas, 1, semente, passo, &antesAtacante, &antesDefensor, corpus);
+            }
+
+            if (resultado.tipo == ATAQUE_VITORIA &&
+                (mapa[d].tropas != antesDefensor.tropas / 2 ||
+                 mapa[d].dono != antesAtacante.dono ||
+                 mapa[a].tropas != antesAtacante.tropas))
+            {
+                registrarFalhaRegra(falhas, 2, semente, passo, &antesAtacante, &antesDefensor, corpus);
+            }
+
+            if (resultado.tipo == ATAQUE_DERROTA &&
+                (mapa[a].tropas != antesAtacante.tropas - 1 || mapa[d].tropas != antesDefensor.tropas))
+            {
+                registrarFalhaRegra(falhas, 3, semente, passo, &antesAtacante, &antesDefensor, corpus);
+            }
+
+            if (resultado.tipo != ATAQUE_VITORIA && resultado.tipo != ATAQUE_DERROTA &&
+                (mapa[a].tropas != antesAtacante.tropas || mapa[d].tropas != antesDefensor.tropas))
+            {
+                registrarFalhaRegra(falhas, 4, semente, passo, &antesAtacante, &antesDefensor, corpus);
+            }
+        }
+
+        // A missão vermelha deve concordar com a referência independente
+        int haVermelho = 0;
+        for (int i = 0; i < TERRITORIOS_VERIFICACAO; i++)
+        {
+            haVermelho |= corEhVermelha(grafias[i]);
+        }
+        if (verificarMissao(MISSAO_VERMELHA, mapa, TERRITORIOS_VERIFICACAO, -1) == haVermelho)
+        {
+            registrarFalhaRegra(falhas, 5, semente, passo, &antesAtacante, &antesDefensor, corpus);
+        }
+
+        // Desfazer tudo deve voltar ao último ponto; refazer, ao estado atual
+        if ((passo + 1) % INTERVALO_DESFAZER == 0)
+        {
+            memcpy(atual, mapa, sizeof(mapa));
+            while (desfazerJogada(&diario, mapa) > 0)
+            {
+            }
+            int voltou = mapasIguais(mapa, ultimoPonto, TERRITORIOS_VERIFICACAO);
+            while (refazerJogada(&diario, mapa) > 0)
+            {
+            }
+            if (!voltou || !mapasIguais(mapa, atual, TERRITORIOS_VERIFICACAO))
+            {
+                registrarFalhaRegra(falhas, 6, semente, passo, &antesAtacante, &antesDefensor, corpus);
+            }
+
+            // Começa um novo trecho do diário a partir do estado atual
+            memcpy(ultimoPonto, mapa, sizeof(mapa));
+            diario.aplicadas = diario.total = diario.concluidas = 0;
+        }
+    }
+
+    liberarDiario(&diario);
+    return 0;
+}
+
+// ============================================================================
+// FUNÇÃO: verificarRegras
+// DESCRIÇÃO: Confere as propriedades das regras sobre uma sequência
+//            aleatória de ações (ver conferirSequencia) e exibe a tabela
+// PARÂMETROS: semente (define toda a sequência), acoes (quantidade de ações)
+//             arquivoCorpus (arquivo onde acrescentar os casos que falharam, ou NULL)
+// RETORNO: quantidade de propriedades violadas (0 se todas valeram)
+// ============================================================================
+int verificarRegras(unsigned long long semente, long long acoes, const char *arquivoCorpus)
+{
+    long long falhas[TOTAL_PROPRIEDADES] = {0};
+    Territorio ultimoAtacante, ultimoDefensor;
+    FILE *corpus = NULL;
+
+    if (arquivoCorpus != NULL && (corpus = fopen(arquivoCorpus, "a")) == NULL)
+    {
+        printf("❌ Erro: Não foi possível abrir %s!\n", arquivoCorpus);
+        return 1;
+    }
+
+    double inicio = agoraSegundos();
+    int erro = conferirSequencia(semente, acoes, falhas, corpus, &ultimoAtacante, &ultimoDefensor);
+    double duracao = agoraSegundos() - inicio;
+    if (corpus != NULL)
+    {
+        fclose(corpus);
+    }
+    if (erro != 0)
+    {
+        printf("❌ Erro: Falha na alocação de memória para o diário!\n");
+        return 1;
+    }
+
+    int violadas = 0;
+    printf("\n%lld ações em %.3f s (%.1f milhões de ações/s)\n\n",
+           acoes, duracao, duracao > 0.0 ? acoes / duracao / 1e6 : 0.0);
+    for (int i = 0; i < TOTAL_PROPRIEDADES; i++)
+    {
+        printf("%s %-55s %lld violações\n", falhas[i] == 0 ? "✅" : "❌",
+               propriedadesRegras[i], falhas[i]);
+        violadas += (falhas[i] != 0);
+    }
+
+    return violadas;
+}
+
+// ============================================================================
+// FUNÇÃO: reproduzirCorpus
+// DESCRIÇÃO: Roda de novo cada caso gravado por registrarFalhaRegra
+//            ("semente acoes propriedade "cor" tropas "cor" tropas") com as
+//            mesmas conferências de verificarRegras. Um caso só passa se a
+//            propriedade gravada vale agora; o estado antes da última ação
+//            também é comparado com o gravado, para avisar quando o gerador
+//            ou a sequência de ações mudou e o caso deixou de reproduzir a falha.
+// PARÂMETROS: arquivoCorpus (arquivo de casos)
+// RETORNO: quantidade de casos que ainda falham ou não puderam ser lidos
+//          (-1 se o arquivo não abrir ou faltar memória)
+// ============================================================================
+int reproduzirCorpus(const char *arquivoCorpus)
+{
+    FILE *corpus = fopen(arquivoCorpus, "r");
+    if (corpus == NULL)
+    {
+        printf("❌ Erro: Não foi possível abrir %s!\n", arquivoCorpus);
+        return -1;
+    }
+
+    char linha[MAX_LINHA_CORPUS];
+    int numero = 0;
+    int casos = 0;
+    int falharam = 0;
+    int invalidos = 0;
+    while (fgets(linha, sizeof(linha), corpus) != NULL)
+    {
+        numero++;
+        if (linha[strspn(linha, " \t\r\n")] == '\0')
+        {
+            continue;
+        }
+
+        unsigned long long semente;
+        long long acoes;
+        int propriedade, tropasAtacante, tropasDefensor;
+        char corAtacante[MAX_COR], corDefensor[MAX_COR]; // %9[ abaixo: MAX_COR - 1
+        if (sscanf(linha, "%llu %lld %d \"%9[^\"]\" %d \"%9[^\"]\" %d", &semente, &acoes, &propriedade,
+                   corAtacante, &tropasAtacante, corDefensor, &tropasDefensor) != 7 ||
+            acoes < 1 || propriedade < 0 || propriedade >= TOTAL_PROPRIEDADES)
+        {
+            printf("❌ Linha %d: caso inválido\n", numero);
+            invalidos++;
+            continue;
+        }
+        casos++;
+
+        long long falhas[TOTAL_PROPRIEDADES] = {0};
+        Territorio atacante, defensor;
+        if (conferirSequencia(semente, acoes, falhas, NULL, &atacante, &defensor) != 0)
+        {
+            printf("❌ Erro: Falha na alocação de memória para o diário!\n");
+            fclose(corpus);
+            return -1;
+        }
+
+        int mesmoEstado = strcmp(tabelaCores[atacante.dono], corAtacante) == 0 &&
+                          atacante.tropas == tropasAtacante &&
+                          strcmp(tabelaCores[defensor.dono], corDefensor) == 0 && defensor.tropas == tropasDefensor;
+        if (falhas[propriedade] != 0)
+        {
+            printf("❌ Linha %d (--verificar-regras %llu %lld): ainda viola \"%s\"\n", numero, semente, acoes,
+                   propriedadesRegras[propriedade]);
+            falharam++;
+        }
+        else
+        {
+            printf("✅ Linha %d (--verificar-regras %llu %lld): \"%s\" vale\n", numero, semente, acoes,
+                   propriedadesRegras[propriedade]);
+        }
+        if (!mesmoEstado)
+        {
+            printf("⚠️  Linha %d: o estado antes da ação não é mais o gravado ([%s] %d x [%s] %d); o caso\n"
+                   "    pode não exercitar mais a falha original\n",
+                   numero, tabelaCores[atacante.dono], atacante.tropas, tabelaCores[defensor.dono], defensor.tropas);
+        }
+    }
+    fclose(corpus);
+
+    printf("\n%d casos reproduzidos de %s | ainda falham: %d | linhas inválidas: %d\n",
+           casos, arquivoCorpus, falharam, invalidos);
+    return falharam + invalidos;
+}
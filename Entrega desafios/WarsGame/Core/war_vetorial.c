@@ -0,0 +1,315 @@
+// NÚCLEO DO JOGO DE GUERRA - VARREDURAS VETORIZADAS DAS MISSÕES
+//
+// OBJETIVO:
+// Verificar as missões sobre as colunas do mapa compacto sem visitar um
+// território por vez:
+// - todas as missões do jogador partem das palavras de donos comparadas de
+//   64 em 64 bits (SWAR), marcando os campos iguais ao dono procurado
+// - "Eliminar vermelha" e "Expandir": as marcas são contadas com popcount
+// - "Manter N tropas": só os territórios marcados têm as tropas lidas
+// - "N territórios seguidos": as marcas deslocadas e combinadas acham as
+//   sequências dentro de cada palavra; as pontas somam com as vizinhas
+// - "maior número inicial": o máximo da coluna fria de tropas iniciais, em
+//   blocos fixos que o compilador transforma em instruções SIMD, dá o
+//   território, e basta conferir o dono dele
+//
+// Em x86-64 com GCC cada varredura é compilada duas vezes (AVX2 e genérica)
+// e a versão é escolhida em tempo de execução conforme o processador. Em
+// ARM64 o NEON já faz parte da arquitetura e é usado diretamente.
+
+#include "war_core.h"
+
+#if defined(__GNUC__) && !defined(__clang__) && defined(__x86_64__) && defined(__linux__)
+#define VARREDURA_DESPACHADA __attribute__((target_clones("arch=x86-64-v3", "default")))
+#else
+#define VARREDURA_DESPACHADA
+#endif
+
+#define TROPAS_POR_BLOCO 16 // Tropas comparadas juntas na busca do máximo
+
+// ============================================================================
+// FUNÇÃO: repetirCampo
+// DESCRIÇÃO: Repete um valor em todos os campos de uma palavra de 64 bits
+// PARÂMETROS: valor (cabe em bits), bits (largura do campo: 1, 2, 4 ou 8)
+// RETORNO: palavra com o valor em todos os campos
+// ============================================================================
+static unsigned long long repetirCampo(unsigned long long valor, int bits)
+{
+    for (int largura = bits; largura < 64; largura *= 2)
+    {
+        valor |= valor << largura;
+    }
+    return valor;
+}
+
+// ============================================================================
+// FUNÇÃO: camposZerados
+// DESCRIÇÃO: Marca o bit mais alto de cada campo que vale zero, sem que um
+//            campo interfira no vizinho (não há "vai um" entre campos)
+// PARÂMETROS: palavra, baixos (cada campo com todos os bits menos o mais alto)
+// RETORNO: palavra com o bit alto ligado nos campos zerados
+// ============================================================================
+static inline unsigned long long camposZerados(unsigned long long palavra, unsigned long long baixos)
+{
+    return ~(((palavra & baixos) + baixos) | palavra | baixos);
+}
+
+// ============================================================================
+// FUNÇÃO: marcarDono
+// DESCRIÇÃO: Marca os campos de uma palavra de donos iguais ao procurado
+// PARÂMETROS: compacto (mapa), p (palavra), procurado (dono repetido em
+//             todos os campos), baixos / altos (máscaras dos campos)
+// RETORNO: bit alto ligado em cada território do dono (os campos depois do
+//          fim do mapa nunca são marcados)
+// ============================================================================
+static inline unsigned long long marcarDono(const MapaCompacto *compacto, int p, unsigned long long procurado,
+                                            unsigned long long baixos, unsigned long long altos)
+{
+    int donosPorPalavra = 64 / compacto->bitsDono;
+    unsigned long long marcas = camposZerados(compacto->donos[p] ^ procurado, baixos) & altos;
+    int restantes = compacto->quantidade - p * donosPorPalavra;
+    if (restantes < donosPorPalavra)
+    {
+        marcas &= (1ULL << (restantes * compacto->bitsDono)) - 1;
+    }
+    return marcas;
+}
+
+// ============================================================================
+// FUNÇÃO: maiorTropasDonoCompacto
+// DESCRIÇÃO: Maior quantidade de tropas em um território do dono. As palavras
+//            de donos são filtradas de 64 em 64 bits e só os territórios
+//            marcados têm as tropas lidas.
+// PARÂMETROS: compacto (mapa), dono (ID da cor)
+//             limite (para ao atingir este valor)
+// RETORNO: maior quantidade de tropas do dono (no máximo "limite"; 0 se o
+//          dono não tiver territórios)
+// ============================================================================
+VARREDURA_DESPACHADA
+int maiorTropasDonoCompacto(const MapaCompacto *compacto, int dono, int limite)
+{
+    int bits = compacto->bitsDono;
+    int donosPorPalavra = 64 / bits;
+    int palavras = (compacto->quantidade + donosPorPalavra - 1) / donosPorPalavra;
+    if (dono < 0 || dono >= (1 << bits))
+    {
+        return 0;
+    }
+
+    unsigned long long altos = repetirCampo(1ULL << (bits - 1), bits);
+    unsigned long long baixos = ~altos;
+    unsigned long long procurado = repetirCampo((unsigned long long)dono, bits);
+    int maior = 0;
+
+    for (int p = 0; p < palavras; p++)
+    {
+        for (unsigned long long marcas = marcarDono(compacto, p, procurado, baixos, altos); marcas != 0;
+             marcas &= marcas - 1)
+        {
+            int id = p * donosPorPalavra + __builtin_ctzll(marcas) / bits;
+            maior = compacto->tropas[id] > maior ? compacto->tropas[id] : maior;
+        }
+        if (maior >= limite)
+        {
+            return limite;
+        }
+    }
+    return maior;
+}
+
+// ============================================================================
+// FUNÇÃO: contarDonoCompacto
+// DESCRIÇÃO: Conta os territórios de um dono
+// PARÂMETROS: compacto (mapa), dono (ID da cor)
+//             limite (para ao atingir este valor; use quantidade para contar tudo)
+// RETORNO: territórios do dono (no máximo "limite")
+// ============================================================================
+VARREDURA_DESPACHADA
+int contarDonoCompacto(const MapaCompacto *compacto, int dono, int limite)
+{
+    int bits = compacto->bitsDono;
+    int donosPorPalavra = 64 / bits;
+    int palavras = (compacto->quantidade + donosPorPalavra - 1) / donosPorPalavra;
+    if (palavras == 0 || dono < 0 || dono >= (1 << bits))
+    {
+        return 0;
+    }
+
+    unsigned long long altos = repetirCampo(1ULL << (bits - 1), bits);
+    unsigned long long baixos = ~altos;
+    unsigned long long procurado = repetirCampo((unsigned long long)dono, bits);
+    int total = 0;
+
+    for (int p = 0; p < palavras; p++)
+    {
+        total += __builtin_popcountll(marcarDono(compacto, p, procurado, baixos, altos));
+        if (total >= limite)
+        {
+            return limite;
+        }
+    }
+    return total < limite ? total : limite;
+}
+
+// ============================================================================
+// FUNÇÃO: sequenciaDonoCompacto
+// DESCRIÇÃO: Procura "tamanho" territórios seguidos do dono. Em cada palavra
+//            as marcas do dono são deslocadas e combinadas (sequências
+//            dentro da palavra); as pontas somam com as palavras vizinhas.
+// PARÂMETROS: compacto (mapa), dono (ID da cor)
+//             tamanho (territórios seguidos exigidos)
+// RETORNO: 1 se existir a sequência, 0 caso contrário
+// ============================================================================
+VARREDURA_DESPACHADA
+int sequenciaDonoCompacto(const MapaCompacto *compacto, int dono, int tamanho)
+{
+    int bits = compacto->bitsDono;
+    int donosPorPalavra = 64 / bits;
+    int palavras = (compacto->quantidade + donosPorPalavra - 1) / donosPorPalavra;
+    if (tamanho <= 0)
+    {
+        // Como em verificarMissao: o primeiro território já basta, mas um
+        // mapa vazio não tem sequência nenhuma
+        return compacto->quantidade > 0;
+    }
+    if (dono < 0 || dono >= (1 << bits))
+    {
+        return 0;
+    }
+
+    unsigned long long altos = repetirCampo(1ULL << (bits - 1), bits);
+    unsigned long long baixos = ~altos;
+    unsigned long long unidades = repetirCampo(1, bits);
+    unsigned long long procurado = repetirCampo((unsigned long long)dono, bits);
+    int seguidos = 0; // Territórios seguidos do dono até o fim da palavra anterior
+
+    for (int p = 0; p < palavras; p++)
+    {
+        // Um bit (o mais baixo do campo) por território do dono
+        unsigned long long marcas = marcarDono(compacto, p, procurado, baixos, altos) >> (bits - 1);
+        if (marcas == unidades)
+        {
+            seguidos += donosPorPalavra;
+            if (seguidos >= tamanho)
+            {
+                return 1;
+            }
+            continue;
+        }
+
+        // Início da palavra: continua a sequência da anterior
+        unsigned long long vazios = ~marcas & unidades;
+        if (seguidos + __builtin_ctzll(vazios) / bits >= tamanho)
+        {
+            return 1;
+        }
+
+        // Dentro da palavra: "tamanho" marcas seguidas sobrevivem aos deslocamentos
+        if (tamanho <= donosPorPalavra)
+        {
+            unsigned long long sequencias = marcas;
+            for (int s = 1; s < tamanho && sequencias != 0; s++)
+            {
+                sequencias &= marcas >> (s * bits);
+            }
+            if (sequencias != 0)
+            {
+                return 1;
+            }
+        }
+
+        // Fim da palavra: começa a sequência da próxima
+        seguidos = donosPorPalavra - 1 - (63 - __builtin_clzll(vazios)) / bits;
+    }
+    return 0;
+}
+
+// ============================================================================
+// FUNÇÃO: maiorColunaCompacto
+// DESCRIÇÃO: Maior valor de uma coluna de 16 bits, em blocos fixos que o
+//            compilador transforma em instruções SIMD
+// PARÂMETROS: coluna, quantidade
+// RETORNO: maior valor (0 se a coluna estiver vazia)
+// ============================================================================
+VARREDURA_DESPACHADA
+static int maiorColunaCompacto(const unsigned short *coluna, int quantidade)
+{
+    unsigned short maiores[TROPAS_POR_BLOCO] = {0};
+    int i = 0;
+
+    for (; i + TROPAS_POR_BLOCO <= quantidade; i += TROPAS_POR_BLOCO)
+    {
+        for (int j = 0; j < TROPAS_POR_BLOCO; j++)
+        {
+            maiores[j] = coluna[i + j] > maiores[j] ? coluna[i + j] : maiores[j];
+        }
+    }
+
+    int maior = 0;
+    for (int j = 0; j < TROPAS_POR_BLOCO; j++)
+    {
+        maior = maiores[j] > maior ? maiores[j] : maior;
+    }
+    for (; i < quantidade; i++)
+    {
+        maior = coluna[i] > maior ? coluna[i] : maior;
+    }
+    return maior;
+}
+
+// ============================================================================
+// FUNÇÃO: maiorInicialCompacto
+// DESCRIÇÃO: Território com mais tropas no cadastro (o primeiro, no empate),
+//            lido da coluna fria de tropas iniciais: o máximo sai da
+//            varredura em blocos e depois basta achar o primeiro com ele
+// PARÂMETROS: compacto (mapa)
+// RETORNO: ID do território, ou -1 se o mapa estiver vazio
+// ============================================================================
+static int maiorInicialCompacto(const MapaCompacto *compacto)
+{
+    int maior = maiorColunaCompacto(compacto->tropasInicial, compacto->quantidade);
+    for (int i = 0; i < compacto->quantidade; i++)
+    {
+        if (compacto->tropasInicial[i] == maior)
+        {
+            return i;
+        }
+    }
+    return -1;
+}
+
+// ============================================================================
+// FUNÇÃO: verificarMissaoCompacto
+// DESCRIÇÃO: Mesma verificação de verificarMissao(), feita sobre o mapa
+//            compacto com as varreduras vetorizadas
+// PARÂMETROS: missao (ID em missoesPredefinidas), compacto (mapa)
+//             donoJogador (ID da cor comandada pelo jogador)
+// RETORNO: 1 se a missão foi cumprida, 0 caso contrário
+// ============================================================================
+int verificarMissaoCompacto(int missao, const MapaCompacto *compacto, int donoJogador)
+{
+    switch (missao)
+    {
+    case MISSAO_SEQUENCIA:
+        return sequenciaDonoCompacto(compacto, donoJogador, regras->territoriosSeguidos);
+
+    case MISSAO_VERMELHA:
+        return idVermelho < 0 || contarDonoCompacto(compacto, idVermelho, 1) == 0;
+
+    case MISSAO_EXPANSAO:
+        return contarDonoCompacto(compacto, donoJogador, regras->territoriosExpansao) >=
+               regras->territoriosExpansao;
+
+    case MISSAO_TROPAS:
+        return maiorTropasDonoCompacto(compacto, donoJogador, regras->tropasMissao) >= regras->tropasMissao;
+
+    case MISSAO_MAIOR_INICIAL:
+    {
+        int maior = maiorInicialCompacto(compacto);
+        return maior >= 0 && donoCompacto(compacto, maior) == donoJogador;
+    }
+
+    default:
+        return 0;
+    }
+}
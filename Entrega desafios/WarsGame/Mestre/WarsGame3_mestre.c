@@ -8,606 +8,687 @@
 // - Verificação de objetivos e condição de vitória baseada em missões
 // - Estrutura modular com funções especializadas
 // - Gerenciamento adequado de ponteiros e memória
+// - Tempo de resposta de cada comando do menu, opcional (--latencias)
+// - Sugestão do ataque que mais aproxima o jogador da sua missão
+// - Limites de memória e de CPU por categoria de partida (--categoria)
 
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <time.h>
 
-// ============================================================================
-// CONSTANTES
-// ============================================================================
-#define MAX_NOME 30
-#define MAX_COR 10
-#define MAX_MISSAO 100
-#define DADOS_ATAQUE 6 // Simulação de dados (1 a 6)
-
-// ============================================================================
-// ESTRUTURA: Territorio
-// Armazena informações sobre um território no jogo de guerra
-// ============================================================================
-typedef struct
-{
-    char nome[MAX_NOME];      // Nome do território
-    char cor[MAX_COR];        // Cor do exército que controla o território
-    int tropas;               // Quantidade de tropas no território
-    char corInicial[MAX_COR]; // Cor inicial no cadastro
-    int tropasInicial;        // Tropas iniciais no cadastro
-} Territorio;
+#include "war_core.h"
 
-// ============================================================================
-// VETOR DE MISSÕES PRÉ-DEFINIDAS
-// Contém 5 missões estratégicas diferentes para o jogo
-// ============================================================================
-char *missoesPredefinidas[] = {
-    "Conquistar 3 territórios seguidos",
-    "Eliminar todas as tropas da cor vermelha",
-    "Expandir para pelo menos 4 territórios diferentes",
-    "Manter 15 tropas em um único território",
-    "Conquistar o território com maior número inicial de tropas"};
-
-#define TOTAL_MISSOES 5
+#define CAPACIDADE_DIARIO_JOGO 4096 // Alterações guardadas para desfazer (2 por ataque)
+#define SUGESTOES_MENU 5            // Ataques mostrados pela opção "Sugerir melhor ataque"
 
 // ============================================================================
 // PROTÓTIPOS DAS FUNÇÕES
+// Demais funções vêm do núcleo compartilhado (war_core.h)
 // ============================================================================
-int lancarDado();
-void atribuirMissao(char **destino, char *missoes[], int totalMissoes, int tamanhoMapa);
-void exibirMissao(char *missao, const char *nomeJogador);
-int verificarMissao(char *missao, Territorio *mapa, int tamanho);
-void cadastrarTerritorios(Territorio *territorios, int quantidade);
-void exibirTerritorios(Territorio *territorios, int quantidade);
-int selecionarTerritorio(int quantidade, const char *mensagem);
-void atacar(Territorio *atacante, Territorio *defensor);
-int verificarVencedor(char **missoes, Territorio *mapa, int quantidadeJogadores, int quantidadeTerritorios);
-void liberarMemoria(Territorio *mapa, char **missoes, int quantidadeJogadores);
-void exibirStatusMissoes(char **missoes, int quantidadeJogadores);
+void liberarMemoria(ArenaPartida *arena, Territorio **mapa, int **missoes);
+void exibirStatusMissoes(const int *missoes, const int *donos, int quantidadeJogadores);
 void exibirMenu();
+int carregarArquivoRegras(const char *caminho);
+int enviarAlteracoes(FluxoDeltas *fluxo, const Territorio *mapa, int quantidade,
+                     const DiarioAlteracoes *diario, int inicio, int fim, int desfeitas);
 
 // ============================================================================
-// FUNÇÃO: lancarDado
-// DESCRIÇÃO: Simula o lançamento de um dado de 6 faces
-// RETORNO: número aleatório entre 1 e 6
+// FUNÇÃO: liberarMemoria
+// DESCRIÇÃO: Libera toda a memória da partida (a arena) e zera os ponteiros
+//            de quem chamou, para que nada use o mapa ou as missões depois
+// PARÂMETROS: arena (orçamento da partida)
+//             mapa / missoes (ponteiros de quem chamou; viram NULL)
 // ============================================================================
-int lancarDado()
+void liberarMemoria(ArenaPartida *arena, Territorio **mapa, int **missoes)
 {
-    return (rand() % DADOS_ATAQUE) + 1;
+    // Mapa e missões moram na arena (ou no pacote do cenário)
+    if (*mapa != NULL)
+    {
+        *mapa = NULL;
+        printf("✅ Memória dos territórios liberada com sucesso!\n");
+    }
+
+    if (*missoes != NULL)
+    {
+        *missoes = NULL;
+        printf("✅ Memória das missões liberada com sucesso!\n");
+    }
+
+    liberarArena(arena);
 }
 
 // ============================================================================
-// FUNÇÃO: atribuirMissao
-// DESCRIÇÃO: Sorteia uma missão aleatória e copia para a variável destino
-//            usando strcpy. A missão é alocada dinamicamente.
-// PARÂMETROS: destino (ponteiro para string onde será armazenada a missão)
-//             missoes[] (vetor de strings contendo as missões disponíveis)
-//             totalMissoes (quantidade de missões disponíveis)
-// NOTA: Passagem por referência - modifica o ponteiro destino
+// FUNÇÃO: abandonarPreparacao
+// DESCRIÇÃO: Desfaz a preparação de uma partida que não pôde começar
+// PARÂMETROS: arena (orçamento da partida), cenario (pacote, se carregado)
+// RETORNO: 1 (o código de saída do programa)
 // ============================================================================
-// Atribui uma missão compatível com o tamanho do mapa
-// Se o mapa tiver poucos territórios, filtra missões que exigem mais territórios
-void atribuirMissao(char **destino, char *missoes[], int totalMissoes, int tamanhoMapa)
+int abandonarPreparacao(ArenaPartida *arena, Cenario *cenario)
 {
-    // Cria um vetor temporário de índices compatíveis
-    int indices[TOTAL_MISSOES];
-    int count = 0;
-
-    for (int i = 0; i < totalMissoes; i++)
+    printf("❌ Erro: Memória da partida esgotada durante a preparação!\n");
+    if (cenario->bloco != NULL)
     {
-        // Missões que exigem pelo menos 3 territórios
-        if (strstr(missoes[i], "Conquistar 3 territórios seguidos") != NULL)
-        {
-            if (tamanhoMapa >= 3)
-            {
-                indices[count++] = i;
-            }
-            continue;
-        }
-
-        // Missões que exigem pelo menos 4 territórios
-        if (strstr(missoes[i], "Expandir para pelo menos 4 territórios diferentes") != NULL)
-        {
-            if (tamanhoMapa >= 4)
-            {
-                indices[count++] = i;
-            }
-            continue;
-        }
-
-        // Outras missões são consideradas compatíveis independentemente do tamanho
-        indices[count++] = i;
+        liberarCenario(cenario);
     }
+    liberarArena(arena);
+    return 1;
+}
 
-    // Se nenhuma missão for compatível (caso extremo), permita qualquer uma
-    int escolha;
-    if (count == 0)
-    {
-        escolha = rand() % totalMissoes;
-    }
-    else
+// ============================================================================
+// FUNÇÃO: carregarArquivoRegras
+// DESCRIÇÃO: Publica as regras de um arquivo e informa a versão carregada
+// PARÂMETROS: caminho (arquivo "chave = valor", ver lerRegras)
+// RETORNO: 0 em caso de sucesso, 1 se o arquivo não pôde ser usado
+// ============================================================================
+int carregarArquivoRegras(const char *caminho)
+{
+    int linhaErro;
+    int erro = recarregarRegras(caminho, &linhaErro);
+    if (erro == 1)
     {
-        escolha = indices[rand() % count];
+        printf("❌ Erro: Não foi possível ler %s!\n", caminho);
+        return 1;
     }
-
-    // Aloca memória dinamicamente para armazenar a missão
-    *destino = (char *)malloc((strlen(missoes[escolha]) + 1) * sizeof(char));
-
-    // Verifica se a alocação foi bem-sucedida
-    if (*destino == NULL)
+    if (erro == 2)
     {
-        printf("❌ Erro: Falha na alocação de memória para a missão!\n");
-        return;
+        printf("❌ Erro: %s tem uma regra inválida na linha %d!\n", caminho, linhaErro);
+        return 1;
     }
 
-    // Copia a missão sorteada para a variável do jogador
-    strcpy(*destino, missoes[escolha]);
+    const RegrasJogo *lidas = fixarRegras();
+    printf("✅ Regras de %s (versão %u): %s, dado de %d faces, missões %d/%d/%d\n", caminho,
+           lidas->versao, lidas->nivel, lidas->facesDado, lidas->territoriosSeguidos,
+           lidas->territoriosExpansao, lidas->tropasMissao);
+    soltarRegras(lidas);
+    return 0;
 }
 
 // ============================================================================
-// FUNÇÃO: exibirMissao
-// DESCRIÇÃO: Exibe a missão atribuída ao jogador
-// PARÂMETROS: missao (passagem por valor - apenas leitura)
-//             nomeJogador (identificador do jogador)
+// FUNÇÃO: exibirMenu
+// DESCRIÇÃO: Exibe o menu de opções do jogo. As opções 1 a 4 mantêm os
+//            números de sempre; as novas entram a partir da 5, e Sair
+//            continua no fim da lista.
 // ============================================================================
-void exibirMissao(char *missao, const char *nomeJogador)
+void exibirMenu()
 {
     printf("\n");
     printf("╔════════════════════════════════════════════════╗\n");
-    printf("║           MISSÃO ESTRATÉGICA DESIGNADA         ║\n");
+    printf("║              MENU PRINCIPAL                    ║\n");
     printf("╚════════════════════════════════════════════════╝\n");
-    printf("🎯 Jogador: %s\n", nomeJogador);
-    printf("📋 Missão: %s\n\n", missao);
+    printf("1. Exibir territórios\n");
+    printf("2. Realizar ataque\n");
+    printf("3. Verificar status das missões\n");
+    printf("5. Desfazer último ataque\n");
+    printf("6. Refazer ataque desfeito\n");
+    printf("7. Sugerir melhor ataque\n");
+    printf("4. Sair\n");
+    printf("Escolha uma opção: ");
 }
 
 // ============================================================================
-// FUNÇÃO: verificarMissao
-// DESCRIÇÃO: Verifica se a missão do jogador foi cumprida analisando
-//            o estado atual do mapa de territórios
-// PARÂMETROS: missao (string contendo a descrição da missão)
-//             mapa (ponteiro para array de territórios)
-//             tamanho (quantidade total de territórios)
-// RETORNO: 1 se a missão foi cumprida, 0 caso contrário
+// FUNÇÃO: exibirStatusMissoes
+// DESCRIÇÃO: Exibe o status atual de todas as missões dos jogadores
+// PARÂMETROS: IDs das missões dos jogadores
+//             donos (cor comandada por cada jogador)
+//             quantidade de jogadores
 // ============================================================================
-int verificarMissao(char *missao, Territorio *mapa, int tamanho)
+void exibirStatusMissoes(const int *missoes, const int *donos, int quantidadeJogadores)
 {
-    // Verifica qual tipo de missão o jogador tem
+    printf("\n");
+    printf("╔════════════════════════════════════════════════╗\n");
+    printf("║         STATUS DAS MISSÕES ATUAIS              ║\n");
+    printf("╚════════════════════════════════════════════════╝\n\n");
 
-    // Missão: Conquistar 3 territórios seguidos
-    if (strstr(missao, "Conquistar 3 territórios seguidos") != NULL)
+    for (int i = 0; i < quantidadeJogadores; i++)
     {
-        // Procura por 3 territórios consecutivos da mesma cor
-        for (int i = 0; i <= tamanho - 3; i++)
-        {
-            if (strcmp(mapa[i].cor, mapa[i + 1].cor) == 0 &&
-                strcmp(mapa[i].cor, mapa[i + 2].cor) == 0)
-            {
-                return 1;
-            }
-        }
-        return 0;
+        char texto[MAX_MISSAO];
+        descreverMissao(missoes[i], texto, sizeof(texto));
+        printf("Jogador %d (%s): %s\n", i + 1, donos[i] >= 0 ? tabelaCores[donos[i]] : "sem exército", texto);
     }
+    printf("\n");
+}
 
-    // Missão: Eliminar todas as tropas da cor vermelha
-    if (strstr(missao, "Eliminar todas as tropas da cor vermelha") != NULL)
+// ============================================================================
+// FUNÇÃO: enviarAlteracoes
+// DESCRIÇÃO: Grava no fluxo de deltas as alterações do diário no intervalo
+//            [inicio, fim) que acabaram de ser desfeitas ou refeitas
+// PARÂMETROS: fluxo, mapa (estado atual), quantidade (territórios)
+//             diario, inicio / fim (alterações envolvidas)
+//             desfeitas (1 se o mapa voltou ao estado "antes", 0 se foi para o "depois")
+// RETORNO: 0 em caso de sucesso, 1 em caso de falha de escrita
+// ============================================================================
+int enviarAlteracoes(FluxoDeltas *fluxo, const Territorio *mapa, int quantidade,
+                     const DiarioAlteracoes *diario, int inicio, int fim, int desfeitas)
+{
+    for (int i = inicio; i < fim; i++)
     {
-        for (int i = 0; i < tamanho; i++)
+        const AlteracaoTerritorio *alteracao = &diario->alteracoes[i];
+        int donoAnterior = desfeitas ? alteracao->donoDepois : alteracao->donoAntes;
+        int tropasAnteriores = desfeitas ? alteracao->tropasDepois : alteracao->tropasAntes;
+
+        if (enviarDelta(fluxo, mapa, quantidade, alteracao->id, donoAnterior, tropasAnteriores) != 0)
         {
-            if (strcmp(mapa[i].cor, "vermelho") == 0 ||
-                strcmp(mapa[i].cor, "Vermelho") == 0 ||
-                strcmp(mapa[i].cor, "vermelha") == 0 ||
-                strcmp(mapa[i].cor, "Vermelha") == 0)
-            {
-                return 0; // Ainda há territórios vermelhos
-            }
+            return 1;
         }
-        return 1;
     }
+    return 0;
+}
 
-    // Missão: Expandir para pelo menos 4 territórios diferentes
-    if (strstr(missao, "Expandir para pelo menos 4 territórios diferentes") != NULL)
+// ============================================================================
+// FUNÇÃO: main
+// DESCRIÇÃO: Função principal que controla o fluxo do programa
+// Inicializa o jogo, atribui missões, gerencia o menu e verifica condições
+// de vitória ao final de cada turno
+// Com "--simular <semente> <jogos> [territorios] [jogadores]" roda partidas
+// sem interação e imprime um resultado por linha
+// Com "--deltas <arquivo>" grava as mudanças do jogo no formato binário, e
+// "--ler-deltas <arquivo>" reconstrói e exibe o mapa gravado
+// Com "--metricas <arquivo>" exporta métricas do Prometheus a cada turno,
+// incluindo as estatísticas das batalhas
+// Com "--bench-memoria <territorios> [jogadores]" compara o mapa comum com o
+// armazenamento compacto
+// Com "--bench-ordem <lado> [ataques]" mede a renumeração dos territórios
+// que aproxima vizinhos na memória (ordem RCM)
+// Com "--verificar-regras <semente> <acoes> [corpus]" confere as propriedades
+// das regras sobre uma sequência aleatória de ações
+// Com "--reproduzir-corpus <corpus>" roda de novo os casos gravados pela
+// verificação, com as mesmas conferências
+// Com "--bench <semente> <turnos> [territorios] [jogadores]" mede o motor do
+// jogo (usado no treino do PGO e na comparação com o baseline)
+// Com "--escalonar <semente> <jogos> [territorios] [jogadores] [humanos%]
+// [regras|-] [categoria]" intercala muitas partidas simultâneas em uma única
+// thread; com um arquivo de regras, ele é recarregado quando muda, sem parar
+// as partidas; com uma categoria, as partidas seguem os limites dela
+// Com "--regras <arquivo>" o jogo interativo usa as regras do arquivo
+// Com "--categoria <casual|ranqueada|torneio>" o jogo interativo recusa um
+// mapa grande demais e freia os comandos que passam do limite de CPU
+// Com "--historico <semente> <turnos> [territorios] [jogadores] [intervalo]
+// [limite-MB]" grava o histórico comprimido de uma partida longa e mede as
+// consultas de turnos e as séries por jogador
+// Com "--lockstep <semente> <sessoes> [territorios] [jogadores] [falha]" joga
+// partidas com um par local trocando só os comandos de cada turno
+// Com "--ambientes <semente> <ambientes> <passos> [territorios] [jogadores]"
+// mede a vazão dos ambientes de treino com um agente aleatório
+// Com "--analisar <semente> <territorios> [jogadores]" mede a análise de
+// todos os ataques possíveis de um mapa e a confere com a exaustiva
+// Com "--gerar-cenario <arquivo> <semente> <territorios> [jogadores]" grava
+// um pacote de cenário, e "--cenario <arquivo>" começa o jogo a partir dele
+// sem cadastro nem sorteio de missões
+// ============================================================================
+int main(int argc, char *argv[])
+{
+    // Modo de simulação em lote (sem interação)
+    if (argc >= 4 && strcmp(argv[1], "--simular") == 0)
     {
-        // Conta quantos territórios a cor do primeiro jogador controla
-        char corJogador[MAX_COR];
-        strcpy(corJogador, "");
+        int territorios = (argc >= 5) ? atoi(argv[4]) : 20;
+        int jogadores = (argc >= 6) ? atoi(argv[5]) : 4;
 
-        // Encontra a primeira cor não vazia
-        for (int i = 0; i < tamanho; i++)
+        if (territorios < 2 || jogadores < 1 || jogadores > TOTAL_CORES_SIMULACAO)
         {
-            if (strlen(mapa[i].cor) > 0)
-            {
-                strcpy(corJogador, mapa[i].cor);
-                break;
-            }
+            fprintf(stderr, "Uso: %s --simular <semente> <jogos> [territorios>=2] [jogadores 1-%d]\n",
+                    argv[0], TOTAL_CORES_SIMULACAO);
+            return 1;
         }
 
-        // Conta territórios da cor do jogador
-        int territoriosControlados = 0;
-        for (int i = 0; i < tamanho; i++)
-        {
-            if (strcmp(mapa[i].cor, corJogador) == 0)
-            {
-                territoriosControlados++;
-            }
-        }
-
-        return territoriosControlados >= 4;
+        return simularPartidas(strtoull(argv[2], NULL, 10), atoi(argv[3]), territorios, jogadores);
     }
 
-    // Missão: Manter 15 tropas em um único território
-    if (strstr(missao, "Manter 15 tropas em um único território") != NULL)
+    // Comparação entre o mapa comum e o armazenamento compacto
+    if (argc >= 3 && strcmp(argv[1], "--bench-memoria") == 0)
     {
-        for (int i = 0; i < tamanho; i++)
+        int territorios = atoi(argv[2]);
+        int jogadores = (argc >= 4) ? atoi(argv[3]) : 4;
+
+        if (territorios < 2 || jogadores < 1 || jogadores > TOTAL_CORES_SIMULACAO)
         {
-            if (mapa[i].tropas >= 15)
-            {
-                return 1;
-            }
+            fprintf(stderr, "Uso: %s --bench-memoria <territorios>=2> [jogadores 1-%d]\n",
+                    argv[0], TOTAL_CORES_SIMULACAO);
+            return 1;
         }
-        return 0;
+
+        return compararArmazenamento(territorios, jogadores);
     }
 
-    // Missão: Conquistar o território com maior número inicial de tropas
-    if (strstr(missao, "Conquistar o território com maior número inicial de tropas") != NULL)
+    // Comparação entre a ordem do cadastro e a ordem RCM dos territórios
+    if (argc >= 3 && strcmp(argv[1], "--bench-ordem") == 0)
     {
-        // Esta simples verificação assume que a primeira cor encontrada é do jogador
-        // Encontra o território com mais tropas
-        int maxTropas = 0;
-        char corMaiorTerritorio[MAX_COR] = "";
+        int lado = atoi(argv[2]);
+        int ataques = (argc >= 4) ? atoi(argv[3]) : 5000000;
 
-        for (int i = 0; i < tamanho; i++)
+        if (lado < 2 || lado > 4096 || ataques < 1)
         {
-            if (mapa[i].tropas > maxTropas)
-            {
-                maxTropas = mapa[i].tropas;
-                strcpy(corMaiorTerritorio, mapa[i].cor);
-            }
+            fprintf(stderr, "Uso: %s --bench-ordem <lado 2-4096> [ataques>=1]\n", argv[0]);
+            return 1;
         }
 
-        // Retorna 1 se a cor atual possui o maior território
-        return maxTropas > 0;
+        return compararOrdemTerritorios(lado, ataques);
     }
 
-    return 0;
-}
-
-// ============================================================================
-// FUNÇÃO: cadastrarTerritorios
-// DESCRIÇÃO: Solicita ao usuário informações dos territórios
-// PARÂMETROS: ponteiro para array de Territorio, quantidade de territórios
-// ============================================================================
-void cadastrarTerritorios(Territorio *territorios, int quantidade)
-{
-    printf("\n");
-    printf("╔════════════════════════════════════════════════╗\n");
-    printf("║    CADASTRO DE TERRITÓRIOS - %d REGIÕES       ║\n", quantidade);
-    printf("╚════════════════════════════════════════════════╝\n\n");
-
-    for (int i = 0; i < quantidade; i++)
+    // Medição de desempenho do motor do jogo
+    if (argc >= 4 && strcmp(argv[1], "--bench") == 0)
     {
-        printf("--- Território %d de %d ---\n", i + 1, quantidade);
-
-        printf("Digite o nome do território: ");
-        fgets(territorios[i].nome, MAX_NOME, stdin);
-        territorios[i].nome[strcspn(territorios[i].nome, "\n")] = '\0';
-
-        printf("Digite a cor do exército: ");
-        fgets(territorios[i].cor, MAX_COR, stdin);
-        territorios[i].cor[strcspn(territorios[i].cor, "\n")] = '\0';
+        long long turnos = atoll(argv[3]);
+        int territorios = (argc >= 5) ? atoi(argv[4]) : 1000;
+        int jogadores = (argc >= 6) ? atoi(argv[5]) : 4;
 
-        // Salva a cor inicial
-        strcpy(territorios[i].corInicial, territorios[i].cor);
-
-        printf("Digite a quantidade de tropas: ");
-        scanf("%d", &territorios[i].tropas);
-        // Salva as tropas iniciais
-        territorios[i].tropasInicial = territorios[i].tropas;
-        getchar();
-
-        printf("\n");
-    }
-}
+        if (turnos <= 0 || territorios < 2 || jogadores < 1 || jogadores > TOTAL_CORES_SIMULACAO)
+        {
+            fprintf(stderr, "Uso: %s --bench <semente> <turnos> [territorios>=2] [jogadores 1-%d]\n",
+                    argv[0], TOTAL_CORES_SIMULACAO);
+            return 1;
+        }
 
-// ============================================================================
-// FUNÇÃO: exibirTerritorios
-// DESCRIÇÃO: Exibe as informações de todos os territórios cadastrados
-// PARÂMETROS: ponteiro para array de Territorio, quantidade de territórios
-// ============================================================================
-void exibirTerritorios(Territorio *territorios, int quantidade)
-{
-    printf("\n");
-    printf("╔════════════════════════════════════════════════╗\n");
-    printf("║        TERRITÓRIOS CADASTRADOS - RESUMO        ║\n");
-    printf("╚════════════════════════════════════════════════╝\n\n");
+        double nsPorTurno = medirDesempenho(strtoull(argv[2], NULL, 10), turnos, territorios, jogadores);
+        if (nsPorTurno < 0.0)
+        {
+            printf("❌ Erro: Falha na alocação de memória para territórios!\n");
+            return 1;
+        }
 
-    for (int i = 0; i < quantidade; i++)
-    {
-        printf("┌────────────────────────────────────────────┐\n");
-        printf("│ Território %d [ID: %d]                      │\n", i + 1, i);
-        printf("├────────────────────────────────────────────┤\n");
-        printf("│ Nome:  %-35s │\n", territorios[i].nome);
-        printf("│ Cor:   %-35s │\n", territorios[i].cor);
-        printf("│ Tropas: %-34d │\n", territorios[i].tropas);
-        printf("└────────────────────────────────────────────┘\n\n");
+        // Linha lida pelo alvo "make bench"
+        printf("ns_por_turno %.1f\n", nsPorTurno);
+        return 0;
     }
-}
-
-// ============================================================================
-// FUNÇÃO: selecionarTerritorio
-// DESCRIÇÃO: Solicita ao usuário a seleção de um território com validação
-// PARÂMETROS: quantidade de territórios disponíveis, mensagem de seleção
-// RETORNO: índice do território selecionado
-// ============================================================================
-int selecionarTerritorio(int quantidade, const char *mensagem)
-{
-    int territorio;
 
-    while (1)
+    // Muitas partidas simultâneas intercaladas em uma thread
+    if (argc >= 4 && strcmp(argv[1], "--escalonar") == 0)
     {
-        printf("%s", mensagem);
-        scanf("%d", &territorio);
-        getchar();
+        int jogos = atoi(argv[3]);
+        int territorios = (argc >= 5) ? atoi(argv[4]) : 20;
+        int jogadores = (argc >= 6) ? atoi(argv[5]) : 4;
+        int humanos = (argc >= 7) ? atoi(argv[6]) : 50;
+        const char *arquivoRegras = (argc >= 8 && strcmp(argv[7], "-") != 0) ? argv[7] : NULL;
+        const LimitesPartida *limites = (argc >= 9) ? buscarLimites(argv[8]) : NULL;
+
+        if (jogos < 1 || territorios < 2 || jogadores < 1 || jogadores > TOTAL_CORES_SIMULACAO ||
+            humanos < 0 || humanos > 100 || (argc >= 9 && limites == NULL))
+        {
+            fprintf(stderr, "Uso: %s --escalonar <semente> <jogos>=1> [territorios>=2] [jogadores 1-%d] [humanos 0-100] "
+                            "[regras|-] [casual|ranqueada|torneio]\n",
+                    argv[0], TOTAL_CORES_SIMULACAO);
+            return 1;
+        }
 
-        // Validação de entrada
-        if (territorio < 0 || territorio >= quantidade)
+        usarRegras(&REGRAS_MESTRE);
+        int erro = executarPartidas(strtoull(argv[2], NULL, 10), jogos, territorios, jogadores, humanos,
+                                    arquivoRegras, limites);
+        if (erro == 2 || erro == 3)
         {
-            printf("❌ Seleção inválida! Digite um ID entre 0 e %d.\n\n", quantidade - 1);
+            return 1;
         }
-        else
+        if (erro != 0)
         {
-            return territorio;
+            printf("❌ Erro: Falha na alocação de memória para as partidas!\n");
+            return 1;
         }
+        return 0;
     }
-}
 
-// ============================================================================
-// FUNÇÃO: atacar
-// DESCRIÇÃO: Simula um ataque entre dois territórios
-// PARÂMETROS: ponteiros para territórios atacante e defensor (passagem por referência)
-// NOTA: O resultado do ataque altera os dados do território defensor
-// ============================================================================
-void atacar(Territorio *atacante, Territorio *defensor)
-{
-    printf("\n");
-    printf("╔════════════════════════════════════════════════╗\n");
-    printf("║            SIMULAÇÃO DE ATAQUE                 ║\n");
-    printf("╚════════════════════════════════════════════════╝\n\n");
-
-    // Validação: não atacar próprio território
-    if (strcmp(atacante->cor, defensor->cor) == 0)
+    // Histórico comprimido de uma partida longa
+    if (argc >= 4 && strcmp(argv[1], "--historico") == 0)
     {
-        printf("❌ ERRO: Você não pode atacar um território de sua própria cor!\n\n");
-        return;
-    }
+        int turnos = atoi(argv[3]);
+        int territorios = (argc >= 5) ? atoi(argv[4]) : 20;
+        int jogadores = (argc >= 6) ? atoi(argv[5]) : 4;
+        int intervalo = (argc >= 7) ? atoi(argv[6]) : 64;
+        int limite = (argc >= 8) ? atoi(argv[7]) : 64;
+
+        if (turnos < 1 || territorios < 2 || jogadores < 1 || jogadores > TOTAL_CORES_SIMULACAO ||
+            intervalo < 1 || limite < 1)
+        {
+            fprintf(stderr, "Uso: %s --historico <semente> <turnos>=1> [territorios>=2] [jogadores 1-%d] [intervalo>=1] [limite-MB>=1]\n",
+                    argv[0], TOTAL_CORES_SIMULACAO);
+            return 1;
+        }
 
-    // Verificar se atacante tem tropas
-    if (atacante->tropas <= 0)
-    {
-        printf("❌ ERRO: O território atacante não tem tropas!\n\n");
-        return;
+        return medirHistorico(strtoull(argv[2], NULL, 10), turnos, territorios, jogadores, intervalo, limite);
     }
 
-    printf("🎲 %s [%s] (%d tropas) atacando %s [%s] (%d tropas)...\n\n",
-           atacante->nome, atacante->cor, atacante->tropas,
-           defensor->nome, defensor->cor, defensor->tropas);
-
-    // Lançar dados
-    int dadoAtacante = lancarDado();
-    int dadoDefensor = lancarDado();
-
-    printf("🎲 Dados de ataque:\n");
-    printf("   • %s [%s] lançou: %d\n", atacante->nome, atacante->cor, dadoAtacante);
-    printf("   • %s [%s] lançou: %d\n\n", defensor->nome, defensor->cor, dadoDefensor);
-
-    // Determinar resultado do ataque
-    if (dadoAtacante > dadoDefensor)
+    // Partidas em lockstep com um par local (só os comandos trafegam)
+    if (argc >= 4 && strcmp(argv[1], "--lockstep") == 0)
     {
-        printf("✅ VITÓRIA! %s conquistou %s!\n\n", atacante->nome, defensor->nome);
-
-        // Calcula tropas transferidas (metade das tropas do defensor)
-        int tropasTransferidas = defensor->tropas / 2;
+        int sessoes = atoi(argv[3]);
+        int territorios = (argc >= 5) ? atoi(argv[4]) : 20;
+        int jogadores = (argc >= 6) ? atoi(argv[5]) : 4;
+        int sessaoComFalha = (argc >= 7) ? atoi(argv[6]) : -1;
 
-        // Atualizar territórios
-        // Defensor perde todas as tropas
-        defensor->tropas = tropasTransferidas;
-
-        // Transfere a cor para o defensor
-        strcpy(defensor->cor, atacante->cor);
+        if (sessoes < 1 || territorios < 2 || jogadores < 2 || jogadores > TOTAL_CORES_SIMULACAO ||
+            sessaoComFalha >= sessoes)
+        {
+            fprintf(stderr, "Uso: %s --lockstep <semente> <sessoes>=1> [territorios>=2] [jogadores 2-%d] [sessao-com-falha]\n",
+                    argv[0], TOTAL_CORES_SIMULACAO);
+            return 1;
+        }
 
-        printf("📊 Resultado:\n");
-        printf("   • %s agora controla %s!\n", atacante->cor, defensor->nome);
-        printf("   • Tropas transferidas: %d\n", tropasTransferidas);
-        printf("   • Novas tropas em %s: %d\n\n", defensor->nome, defensor->tropas);
+        return executarLockstep(strtoull(argv[2], NULL, 10), sessoes, territorios, jogadores, sessaoComFalha);
     }
-    else if (dadoAtacante < dadoDefensor)
+
+    // Vazão dos ambientes de treino
+    if (argc >= 5 && strcmp(argv[1], "--ambientes") == 0)
     {
-        printf("❌ DERROTA! %s repeliu o ataque de %s!\n\n",
-               defensor->nome, atacante->nome);
+        int ambientes = atoi(argv[3]);
+        long long passos = atoll(argv[4]);
+        int territorios = (argc >= 6) ? atoi(argv[5]) : 20;
+        int jogadores = (argc >= 7) ? atoi(argv[6]) : 4;
 
-        // Atacante perde uma tropa
-        if (atacante->tropas > 0)
+        if (ambientes < 1 || passos < 1 || territorios < 2 || jogadores < 1 ||
+            jogadores > TOTAL_CORES_SIMULACAO)
         {
-            atacante->tropas--;
-            printf("📊 Resultado:\n");
-            printf("   • %s perdeu 1 tropa na batalha.\n", atacante->nome);
-            printf("   • Tropas restantes em %s: %d\n\n", atacante->nome, atacante->tropas);
+            fprintf(stderr, "Uso: %s --ambientes <semente> <ambientes>=1> <passos>=1> [territorios>=2] [jogadores 1-%d]\n",
+                    argv[0], TOTAL_CORES_SIMULACAO);
+            return 1;
         }
-        else
+
+        int erro = medirAmbientes(strtoull(argv[2], NULL, 10), ambientes, passos, territorios, jogadores);
+        if (erro == 1)
         {
-            printf("⚠️  %s não tinha tropas para perder!\n\n", atacante->nome);
+            printf("❌ Erro: Falha na alocação de memória para os ambientes!\n");
         }
+        return erro != 0;
     }
-    else
+
+    // Pacote de cenário pronto para carregar
+    if (argc >= 5 && strcmp(argv[1], "--gerar-cenario") == 0)
     {
-        printf("🤝 EMPATE! Nenhum território muda de controle.\n");
-        printf("   • %s mantém %s\n\n", defensor->cor, defensor->nome);
+        int territorios = atoi(argv[4]);
+        int jogadores = (argc >= 6) ? atoi(argv[5]) : 4;
+
+        if (territorios < 2 || jogadores < 1 || jogadores > TOTAL_CORES_SIMULACAO)
+        {
+            fprintf(stderr, "Uso: %s --gerar-cenario <arquivo> <semente> <territorios>=2> [jogadores 1-%d]\n",
+                    argv[0], TOTAL_CORES_SIMULACAO);
+            return 1;
+        }
+
+        return gerarCenario(argv[2], strtoull(argv[3], NULL, 10), territorios, jogadores) != 0;
     }
-}
 
-// ============================================================================
-// FUNÇÃO: verificarVencedor
-// DESCRIÇÃO: Verifica se algum jogador completou sua missão ao final do turno
-// PARÂMETROS: ponteiro para array de strings com missões dos jogadores
-//             ponteiro para array de territórios
-//             quantidade de jogadores
-//             quantidade de territórios
-// RETORNO: índice do jogador vencedor (-1 se nenhum venceu ainda)
-// ============================================================================
-int verificarVencedor(char **missoes, Territorio *mapa, int quantidadeJogadores, int quantidadeTerritorios)
-{
-    for (int i = 0; i < quantidadeJogadores; i++)
+    // Análise de todos os ataques de um mapa grande
+    if (argc >= 4 && strcmp(argv[1], "--analisar") == 0)
     {
-        if (missoes[i] != NULL && verificarMissao(missoes[i], mapa, quantidadeTerritorios))
+        int territorios = atoi(argv[3]);
+        int jogadores = (argc >= 5) ? atoi(argv[4]) : 4;
+
+        if (territorios < 2 || jogadores < 2 || jogadores > TOTAL_CORES_SIMULACAO)
         {
-            return i;
+            fprintf(stderr, "Uso: %s --analisar <semente> <territorios>=2> [jogadores 2-%d]\n",
+                    argv[0], TOTAL_CORES_SIMULACAO);
+            return 1;
         }
+
+        return medirAnalise(strtoull(argv[2], NULL, 10), territorios, jogadores);
     }
-    return -1;
-}
 
-// ============================================================================
-// FUNÇÃO: liberarMemoria
-// DESCRIÇÃO: Libera toda a memória alocada dinamicamente
-// PARÂMETROS: ponteiro para array de territórios
-//             ponteiro para array de strings com missões dos jogadores
-//             quantidade de jogadores
-// ============================================================================
-void liberarMemoria(Territorio *mapa, char **missoes, int quantidadeJogadores)
-{
-    // Liberar memória dos territórios
-    if (mapa != NULL)
+    // Verificação das propriedades das regras
+    if (argc >= 4 && strcmp(argv[1], "--verificar-regras") == 0)
     {
-        free(mapa);
-        mapa = NULL;
-        printf("✅ Memória dos territórios liberada com sucesso!\n");
+        return verificarRegras(strtoull(argv[2], NULL, 10), atoll(argv[3]),
+                               (argc >= 5) ? argv[4] : NULL) != 0;
     }
 
-    // Liberar memória de cada missão
-    if (missoes != NULL)
+    // Casos mínimos gravados pela verificação, rodados de novo
+    if (argc >= 3 && strcmp(argv[1], "--reproduzir-corpus") == 0)
     {
-        for (int i = 0; i < quantidadeJogadores; i++)
+        return reproduzirCorpus(argv[2]) != 0;
+    }
+
+    // Leitura de um fluxo de deltas gravado
+    if (argc >= 3 && strcmp(argv[1], "--ler-deltas") == 0)
+    {
+        FILE *arquivo = fopen(argv[2], "rb");
+        if (arquivo == NULL)
         {
-            if (missoes[i] != NULL)
-            {
-                free(missoes[i]);
-                missoes[i] = NULL;
-            }
+            printf("❌ Erro: Não foi possível abrir %s!\n", argv[2]);
+            return 1;
         }
 
-        // Liberar o array de missões
-        free(missoes);
-        missoes = NULL;
-        printf("✅ Memória das missões liberada com sucesso!\n");
-    }
-}
+        Territorio *mapaLido = NULL;
+        int quantidadeLida = 0;
+        int registros = decodificarFluxo(arquivo, &mapaLido, &quantidadeLida);
+        fclose(arquivo);
 
-// ============================================================================
-// FUNÇÃO: exibirMenu
-// DESCRIÇÃO: Exibe o menu de opções do jogo
-// ============================================================================
-void exibirMenu()
-{
-    printf("\n");
-    printf("╔════════════════════════════════════════════════╗\n");
-    printf("║              MENU PRINCIPAL                    ║\n");
-    printf("╚════════════════════════════════════════════════╝\n");
-    printf("1. Exibir territórios\n");
-    printf("2. Realizar ataque\n");
-    printf("3. Verificar status das missões\n");
-    printf("4. Sair\n");
-    printf("Escolha uma opção: ");
-}
+        if (registros < 0)
+        {
+            printf("❌ Erro: Fluxo de deltas inválido ou incompleto!\n");
+            free(mapaLido);
+            return 1;
+        }
 
-// ============================================================================
-// FUNÇÃO: exibirStatusMissoes
-// DESCRIÇÃO: Exibe o status atual de todas as missões dos jogadores
-// PARÂMETROS: ponteiro para array de strings com missões
-//             quantidade de jogadores
-// ============================================================================
-void exibirStatusMissoes(char **missoes, int quantidadeJogadores)
-{
-    printf("\n");
-    printf("╔════════════════════════════════════════════════╗\n");
-    printf("║         STATUS DAS MISSÕES ATUAIS              ║\n");
-    printf("╚════════════════════════════════════════════════╝\n\n");
+        printf("✅ %d registros lidos de %s\n", registros, argv[2]);
+        exibirTerritorios(mapaLido, quantidadeLida);
+        free(mapaLido);
+        return 0;
+    }
 
-    for (int i = 0; i < quantidadeJogadores; i++)
+    // Opções do jogo interativo
+    FluxoDeltas fluxo;
+    DiarioAlteracoes diario;
+    IndiceNomes indiceNomes;
+    AnaliseAtaques analise;
+    static EstatisticasBatalhas estatisticas;
+    static LatenciasComandos latencias;
+    Cenario cenario = {0};
+    ArenaPartida arena = {0};
+    FILE *arquivoDeltas = NULL;
+    const char *arquivoMetricas = NULL;
+    const char *arquivoCenario = NULL;
+    const char *arquivoRegras = NULL;
+    const LimitesPartida *limites = NULL;
+    ConsumoPartida consumo = {0};
+    int medirLatencias = 0;
+
+    for (int i = 1; i + 1 < argc; i += 2)
     {
-        printf("Jogador %d: %s\n", i + 1, missoes[i] != NULL ? missoes[i] : "Sem missão");
+        if (strcmp(argv[i], "--deltas") == 0)
+        {
+            // Gravação das mudanças do jogo para visualizadores remotos
+            arquivoDeltas = fopen(argv[i + 1], "wb");
+            if (arquivoDeltas == NULL || iniciarFluxoDeltas(&fluxo, arquivoDeltas) != 0)
+            {
+                printf("❌ Erro: Não foi possível criar %s!\n", argv[i + 1]);
+                return 1;
+            }
+        }
+        else if (strcmp(argv[i], "--metricas") == 0)
+        {
+            arquivoMetricas = argv[i + 1];
+            estatisticasBatalhas = &estatisticas;
+        }
+        else if (strcmp(argv[i], "--cenario") == 0)
+        {
+            arquivoCenario = argv[i + 1];
+        }
+        else if (strcmp(argv[i], "--regras") == 0)
+        {
+            arquivoRegras = argv[i + 1];
+        }
+        else if (strcmp(argv[i], "--categoria") == 0)
+        {
+            limites = buscarLimites(argv[i + 1]);
+            if (limites == NULL)
+            {
+                printf("❌ Erro: Categoria %s desconhecida (casual, ranqueada ou torneio)!\n", argv[i + 1]);
+                return 1;
+            }
+        }
+        else if (strcmp(argv[i], "--latencias") == 0)
+        {
+            // Tempo de resposta de cada comando, com registro da sessão
+            if (iniciarLatencias(&latencias, argv[i + 1]) != 0)
+            {
+                printf("❌ Erro: Não foi possível criar %s!\n", argv[i + 1]);
+                return 1;
+            }
+            medirLatencias = 1;
+        }
     }
-    printf("\n");
-}
 
-// ============================================================================
-// FUNÇÃO: main
-// DESCRIÇÃO: Função principal que controla o fluxo do programa
-// Inicializa o jogo, atribui missões, gerencia o menu e verifica condições
-// de vitória ao final de cada turno
-// ============================================================================
-int main()
-{
     // Inicializar o gerador de números aleatórios com seed baseado no tempo
-    srand(time(NULL));
+    semearAleatorio((unsigned long long)time(NULL));
+    usarRegras(&REGRAS_MESTRE);
+    if (arquivoRegras != NULL && carregarArquivoRegras(arquivoRegras) != 0)
+    {
+        return 1;
+    }
+
+    // A partida fica com a versão das regras de agora até o fim
+    const RegrasJogo *regrasDaPartida = fixarRegras();
+    usarRegras(regrasDaPartida);
 
     int quantidadeTerritorios = 0;
     int quantidadeJogadores = 0;
     Territorio *mapa = NULL;
-    char **missoes = NULL;
+    int *missoes = NULL;
+    int *donos = NULL;
 
     printf("╔════════════════════════════════════════════════╗\n");
     printf("║      BEM-VINDO AO JOGO DE GUERRA              ║\n");
     printf("║    COM MISSÕES ESTRATÉGICAS - VERSÃO 3.0      ║\n");
     printf("╚════════════════════════════════════════════════╝\n");
 
-    // Solicitar quantidade de territórios
-    printf("\nDigite a quantidade de territórios a criar: ");
-    scanf("%d", &quantidadeTerritorios);
-    getchar();
-
-    // Validar entrada
-    if (quantidadeTerritorios <= 0)
+    if (arquivoCenario != NULL)
     {
-        printf("❌ Quantidade inválida! Deve ser maior que zero.\n");
-        return 1;
+        // Por enquanto só o cabeçalho: o tamanho da partida passa pelo limite
+        // da categoria antes de o pacote inteiro ser lido
+        CabecalhoCenario cabecalho;
+        int erro = lerCabecalhoCenario(&cabecalho, arquivoCenario);
+        if (erro != 0)
+        {
+            printf(erro == 1 ? "❌ Erro: Não foi possível ler %s!\n"
+                             : "❌ Erro: %s não é um pacote de cenário válido para este programa!\n",
+                   arquivoCenario);
+            return 1;
+        }
+        quantidadeTerritorios = (int)cabecalho.quantidadeTerritorios;
+        quantidadeJogadores = (int)cabecalho.quantidadeJogadores;
+    }
+    else
+    {
+        // Solicitar quantidade de territórios
+        printf("\nDigite a quantidade de territórios a criar: ");
+        scanf("%d", &quantidadeTerritorios);
+        getchar();
+
+        // Validar entrada
+        if (quantidadeTerritorios <= 0)
+        {
+            printf("❌ Quantidade inválida! Deve ser maior que zero.\n");
+            return 1;
+        }
+
+        // Solicitar quantidade de jogadores
+        printf("Digite a quantidade de jogadores: ");
+        scanf("%d", &quantidadeJogadores);
+        getchar();
+
+        // Validar entrada
+        if (quantidadeJogadores <= 0)
+        {
+            printf("❌ Quantidade inválida! Deve ser maior que zero.\n");
+            return 1;
+        }
     }
 
-    // Solicitar quantidade de jogadores
-    printf("Digite a quantidade de jogadores: ");
-    scanf("%d", &quantidadeJogadores);
-    getchar();
+    // Toda a memória da partida é reservada agora: sem memória, o jogo nem
+    // começa, e nenhum turno precisa alocar nada
+    size_t orcamento = orcamentoJogo(quantidadeTerritorios, quantidadeJogadores,
+                                     CAPACIDADE_DIARIO_JOGO, arquivoCenario == NULL);
 
-    // Validar entrada
-    if (quantidadeJogadores <= 0)
+    // O limite da categoria vale para mapa e missões mesmo vindos do cenário
+    consumo.memoriaBytes = orcamentoJogo(quantidadeTerritorios, quantidadeJogadores, CAPACIDADE_DIARIO_JOGO, 1);
+    if (conferirMemoria(limites, consumo.memoriaBytes) != 0)
     {
-        printf("❌ Quantidade inválida! Deve ser maior que zero.\n");
+        printf("❌ Partida grande demais para a categoria %s: %.1f MB (limite de %.1f MB)!\n",
+               limites->categoria, consumo.memoriaBytes / 1048576.0, limites->memoriaMaxima / 1048576.0);
         return 1;
     }
 
-    // Alocação dinâmica de memória para os territórios
-    mapa = (Territorio *)calloc(quantidadeTerritorios, sizeof(Territorio));
+    if (arquivoCenario != NULL)
+    {
+        // Mapa e missões prontos: uma leitura e algumas correções (o
+        // pacote tem de ser o mesmo cujo cabeçalho passou pelo limite)
+        double inicioCarga = agoraSegundos();
+        int erro = carregarCenario(&cenario, arquivoCenario);
+        if (erro == 0 && (cenario.quantidadeTerritorios != quantidadeTerritorios ||
+                          cenario.quantidadeJogadores != quantidadeJogadores))
+        {
+            liberarCenario(&cenario);
+            erro = 2;
+        }
+        if (erro != 0)
+        {
+            printf(erro == 1 ? "❌ Erro: Não foi possível ler %s!\n"
+                             : "❌ Erro: %s não é um pacote de cenário válido para este programa!\n",
+                   arquivoCenario);
+            return 1;
+        }
 
-    // Verificar se a alocação foi bem-sucedida
-    if (mapa == NULL)
+        mapa = cenario.mapa;
+        missoes = cenario.missoes;
+        printf("\n✅ Cenário carregado em %.3f ms: %d territórios e %d jogadores!\n",
+               (agoraSegundos() - inicioCarga) * 1e3, quantidadeTerritorios, quantidadeJogadores);
+    }
+
+    if (reservarArena(&arena, orcamento) != 0)
     {
-        printf("❌ Erro: Falha na alocação de memória para territórios!\n");
+        printf("❌ Erro: Memória insuficiente para a partida (%.1f MB)!\n", orcamento / 1048576.0);
+        if (cenario.bloco != NULL)
+        {
+            liberarCenario(&cenario);
+        }
         return 1;
     }
 
-    printf("✅ Memória alocada com sucesso para %d territórios!\n\n", quantidadeTerritorios);
+    if (cenario.bloco == NULL)
+    {
+        mapa = (Territorio *)alocarArena(&arena, quantidadeTerritorios * sizeof(Territorio));
+        missoes = (int *)alocarArena(&arena, quantidadeJogadores * sizeof(int));
+        if (mapa == NULL || missoes == NULL)
+        {
+            return abandonarPreparacao(&arena, &cenario);
+        }
+        printf("✅ Memória reservada para %d territórios e %d missões!\n\n",
+               quantidadeTerritorios, quantidadeJogadores);
+    }
 
-    // Alocação dinâmica de memória para as missões dos jogadores
-    missoes = (char **)malloc(quantidadeJogadores * sizeof(char *));
+    // Cor comandada por cada jogador (a i-ésima cor distinta do mapa)
+    donos = (int *)alocarArena(&arena, quantidadeJogadores * sizeof(int));
 
-    // Verificar se a alocação foi bem-sucedida
-    if (missoes == NULL)
+    // Diário dos ataques, para desfazer e refazer, e vetores da sugestão de
+    // ataques (tamanho fixo, na arena)
+    if (donos == NULL || iniciarDiario(&diario, CAPACIDADE_DIARIO_JOGO, &arena) != 0 ||
+        iniciarAnalise(&analise, quantidadeTerritorios, &arena) != 0)
     {
-        printf("❌ Erro: Falha na alocação de memória para missões!\n");
-        liberarMemoria(mapa, NULL, 0);
-        return 1;
+        return abandonarPreparacao(&arena, &cenario);
     }
 
-    printf("✅ Memória alocada com sucesso para %d missões!\n\n", quantidadeJogadores);
+    metricas.partidasAtivas = 1;
+    metricas.memoriaBytes = (long long)arena.capacidade;
+
+    // Cadastrar os territórios (o cenário já vem com eles)
+    if (cenario.bloco == NULL)
+    {
+        cadastrarTerritorios(mapa, quantidadeTerritorios);
+    }
+    coresDosJogadores(mapa, quantidadeTerritorios, donos, quantidadeJogadores);
 
-    // Cadastrar os territórios
-    cadastrarTerritorios(mapa, quantidadeTerritorios);
+    // As batalhas desta partida contam os territórios disputados pelo ID
+    marcarPartidaEstatisticas(&estatisticas, 0, mapa, quantidadeTerritorios);
+
+    // Índice dos nomes: os territórios podem ser escolhidos pelo nome
+    if (construirIndiceNomes(&indiceNomes, mapa, quantidadeTerritorios, &arena) != 0)
+    {
+        return abandonarPreparacao(&arena, &cenario);
+    }
+
+    // A fotografia inicial permite que o visualizador monte o mapa
+    if (arquivoDeltas != NULL && enviarSnapshot(&fluxo, mapa, quantidadeTerritorios) != 0)
+    {
+        printf("⚠️  Falha ao gravar deltas; a gravação foi desativada.\n");
+        fclose(arquivoDeltas);
+        arquivoDeltas = NULL;
+    }
 
     // Atribuir missões para cada jogador
     printf("\n");
@@ -615,13 +696,22 @@ int main()
     printf("║        ATRIBUIÇÃO DE MISSÕES AOS JOGADORES     ║\n");
     printf("╚════════════════════════════════════════════════╝\n");
 
+    // Sorteio sem repetição entre as missões compatíveis com a quantidade de
+    // territórios, pulando as que o jogador já cumpriu ou não consegue cumprir
+    SorteioMissoes sorteio;
+    iniciarSorteioMissoes(&sorteio, quantidadeTerritorios);
     for (int i = 0; i < quantidadeJogadores; i++)
     {
-        // Atribui a missão de forma aleatória compatível com a quantidade de territórios
-        atribuirMissao(&missoes[i], missoesPredefinidas, TOTAL_MISSOES, quantidadeTerritorios);
+        if (cenario.bloco == NULL)
+        {
+            missoes[i] = sortearMissao(&sorteio, NULL, mapa, quantidadeTerritorios, donos[i]);
+        }
 
         // Exibe a missão ao jogador
-        exibirMissao(missoes[i], "Jogador");
+        char nomeJogador[MAX_NOME + MAX_COR];
+        snprintf(nomeJogador, sizeof(nomeJogador), "Jogador %d (%s)", i + 1,
+                 donos[i] >= 0 ? tabelaCores[donos[i]] : "sem exército");
+        exibirMissao(missoes[i], nomeJogador);
     }
 
     // Menu de interação
@@ -629,14 +719,39 @@ int main()
     int continuar = 1;
     int vencedor = -1;
     int turno = 0; // contador de turnos para evitar verificar vitória imediatamente após atribuição
+    double inicioTurno = 0.0; // instante do último ataque, para medir a duração do turno
 
     while (continuar)
     {
+        // CPU do turno inteiro: verificação, menu e comando (a espera pela
+        // digitação não gasta CPU e fica de fora sozinha)
+        long long inicioCpu = (limites != NULL) ? cpuThreadNs() : 0;
+
         // Não verificar vitória no primeiro ciclo imediatamente após atribuição
         if (turno > 0)
         {
             // Verificar se algum jogador venceu (após cada ação)
-            vencedor = verificarVencedor(missoes, mapa, quantidadeJogadores, quantidadeTerritorios);
+            double inicioVerificacao = agoraSegundos();
+            vencedor = verificarVencedor(missoes, donos, mapa, quantidadeJogadores, quantidadeTerritorios);
+            if (medirLatencias)
+            {
+                registrarLatencia(&latencias, COMANDO_VERIFICAR_VENCEDOR,
+                                  agoraSegundos() - inicioVerificacao);
+            }
+
+            if (inicioTurno > 0.0)
+            {
+                registrarDuracaoTurno(agoraSegundos() - inicioTurno);
+                inicioTurno = 0.0;
+            }
+            if (vencedor != -1)
+            {
+                metricas.missoesCumpridas[missoes[vencedor]]++;
+            }
+            if (arquivoMetricas != NULL && exportarMetricas(arquivoMetricas) != 0)
+            {
+                printf("⚠️  Falha ao exportar métricas para %s.\n", arquivoMetricas);
+            }
 
             if (vencedor != -1)
             {
@@ -644,7 +759,9 @@ int main()
                 printf("╔════════════════════════════════════════════════╗\n");
                 printf("║              TEMOS UM VENCEDOR!               ║\n");
                 printf("╚════════════════════════════════════════════════╝\n");
-                printf("🎉 Jogador %d cumpriu sua missão: %s\n\n", vencedor + 1, missoes[vencedor]);
+                char texto[MAX_MISSAO];
+                descreverMissao(missoes[vencedor], texto, sizeof(texto));
+                printf("🎉 Jogador %d cumpriu sua missão: %s\n\n", vencedor + 1, texto);
                 printf("Parabéns! Você venceu o jogo!\n\n");
                 continuar = 0;
                 break;
@@ -655,6 +772,10 @@ int main()
         scanf("%d", &opcao);
         getchar();
 
+        // Tempo de resposta do comando, descontada a espera pela digitação
+        double inicioComando = agoraSegundos();
+        double esperaJogador = 0.0;
+
         switch (opcao)
         {
         case 1:
@@ -673,10 +794,28 @@ int main()
 
             exibirTerritorios(mapa, quantidadeTerritorios);
 
-            int idAtacante = selecionarTerritorio(quantidadeTerritorios,
-                                                  "\nDigite o ID do território atacante: ");
-            int idDefensor = selecionarTerritorio(quantidadeTerritorios,
-                                                  "Digite o ID do território defensor: ");
+            double inicioEspera = agoraSegundos();
+            int idDefensor = -1;
+
+            // Aceita ID, nome, começo do nome ou "Atacante -> Defensor"
+            int idAtacante = selecionarTerritorioPorNome(&indiceNomes,
+                                                         "\nDigite o ID ou o nome do território atacante "
+                                                         "(ou \"atacante -> defensor\"): ",
+                                                         &idDefensor);
+            if (idAtacante >= 0 && idDefensor < 0)
+            {
+                idDefensor = selecionarTerritorioPorNome(&indiceNomes,
+                                                         "Digite o ID ou o nome do território defensor: ",
+                                                         NULL);
+            }
+            esperaJogador = agoraSegundos() - inicioEspera;
+
+            // Fim da entrada: nada a atacar
+            if (idAtacante < 0 || idDefensor < 0)
+            {
+                printf("\n❌ Ataque cancelado.\n");
+                break;
+            }
 
             // Validar se são territórios diferentes
             if (idAtacante == idDefensor)
@@ -685,18 +824,98 @@ int main()
                 break;
             }
 
-            // Realizar o ataque
+            // Guarda o estado anterior para gravar apenas o que mudou
+            int donoAtacante = mapa[idAtacante].dono;
+            int donoDefensor = mapa[idDefensor].dono;
+            int tropasAtacante = mapa[idAtacante].tropas;
+            int tropasDefensor = mapa[idDefensor].tropas;
+
+            // Realizar o ataque (o turno é medido até a verificação de vencedor)
+            inicioTurno = agoraSegundos();
+            anotarAlteracao(&diario, mapa, idAtacante);
+            anotarAlteracao(&diario, mapa, idDefensor);
             atacar(&mapa[idAtacante], &mapa[idDefensor]);
+            concluirAlteracoes(&diario, mapa);
             turno++;
 
+            if (arquivoDeltas != NULL &&
+                (enviarDelta(&fluxo, mapa, quantidadeTerritorios, idAtacante,
+                             donoAtacante, tropasAtacante) != 0 ||
+                 enviarDelta(&fluxo, mapa, quantidadeTerritorios, idDefensor,
+                             donoDefensor, tropasDefensor) != 0))
+            {
+                printf("⚠️  Falha ao gravar deltas; a gravação foi desativada.\n");
+                fclose(arquivoDeltas);
+                arquivoDeltas = NULL;
+            }
+
             break;
         }
 
         case 3:
             // Exibir status das missões
-            exibirStatusMissoes(missoes, quantidadeJogadores);
+            exibirStatusMissoes(missoes, donos, quantidadeJogadores);
             break;
 
+        case 5:
+        case 6:
+        {
+            // Desfazer ou refazer um ataque
+            int antes = diario.aplicadas;
+            int alterados = (opcao == 5) ? desfazerJogada(&diario, mapa) : refazerJogada(&diario, mapa);
+
+            if (alterados == 0)
+            {
+                printf("❌ Não há ataque para %s!\n", opcao == 5 ? "desfazer" : "refazer");
+                break;
+            }
+
+            printf("✅ Ataque %s.\n", opcao == 5 ? "desfeito" : "refeito");
+            exibirTerritorios(mapa, quantidadeTerritorios);
+            turno++;
+
+            if (arquivoDeltas != NULL &&
+                (opcao == 5 ? enviarAlteracoes(&fluxo, mapa, quantidadeTerritorios, &diario,
+                                               diario.aplicadas, antes, 1)
+                            : enviarAlteracoes(&fluxo, mapa, quantidadeTerritorios, &diario,
+                                               antes, diario.aplicadas, 0)) != 0)
+            {
+                printf("⚠️  Falha ao gravar deltas; a gravação foi desativada.\n");
+                fclose(arquivoDeltas);
+                arquivoDeltas = NULL;
+            }
+            break;
+        }
+
+        case 7:
+        {
+            // Sugerir os ataques que mais aproximam o jogador da sua missão
+            int jogador = 0;
+            double inicioEspera = agoraSegundos();
+            printf("Digite o número do jogador (1-%d): ", quantidadeJogadores);
+            scanf("%d", &jogador);
+            getchar();
+            esperaJogador = agoraSegundos() - inicioEspera;
+
+            if (jogador < 1 || jogador > quantidadeJogadores || donos[jogador - 1] < 0)
+            {
+                printf("❌ Jogador inválido ou sem exército no mapa!\n");
+                break;
+            }
+
+            SugestaoAtaque sugestoes[SUGESTOES_MENU];
+            int quantidade = analisarAtaques(&analise, missoes[jogador - 1], mapa, quantidadeTerritorios,
+                                             donos[jogador - 1], sugestoes, SUGESTOES_MENU);
+            if (quantidade < 0)
+            {
+                printf("❌ Erro: A análise de ataques não está disponível!\n");
+                break;
+            }
+            exibirSugestoes(sugestoes, quantidade, missoes[jogador - 1], mapa, quantidadeTerritorios,
+                            donos[jogador - 1]);
+            break;
+        }
+
         case 4:
             // Sair do programa
             printf("\n");
@@ -710,10 +929,62 @@ int main()
         default:
             printf("❌ Opção inválida! Tente novamente.\n");
         }
+
+        if (medirLatencias && opcao >= 1 && opcao <= 7)
+        {
+            registrarLatencia(&latencias, (ComandoMenu)(opcao - 1),
+                              agoraSegundos() - inicioComando - esperaJogador);
+        }
+
+        if (limites != NULL)
+        {
+            long long cpuTurno = cpuThreadNs() - inicioCpu;
+            long long espera = registrarCpuTurno(&consumo, limites, cpuTurno);
+            if (espera > 0 && continuar)
+            {
+                printf("⚠️  O turno usou %.1f ms de CPU (limite da categoria %s: %.1f ms); aguarde %lld ms.\n",
+                       cpuTurno / 1e6, limites->categoria, limites->cpuTurnoNs / 1e6, espera);
+                esperarFreio(espera);
+            }
+        }
+    }
+
+    if (limites != NULL)
+    {
+        printf("📊 Categoria %s: %.1f MB de %.1f MB | CPU de %.1f ms em %lld turnos, maior turno %.1f ms | %lld turnos freados\n",
+               limites->categoria, consumo.memoriaBytes / 1048576.0, limites->memoriaMaxima / 1048576.0,
+               consumo.cpuTotalNs / 1e6, consumo.turnosMedidos, consumo.cpuMaiorTurnoNs / 1e6,
+               consumo.turnosFreados);
     }
 
-    // Liberar memória alocada
-    liberarMemoria(mapa, missoes, quantidadeJogadores);
+    if (medirLatencias)
+    {
+        encerrarLatencias(&latencias);
+    }
+
+    // Liberar memória (mapa e missões do cenário moram no pacote)
+    liberarDiario(&diario);
+    liberarIndiceNomes(&indiceNomes);
+    liberarAnalise(&analise);
+    if (cenario.bloco != NULL)
+    {
+        liberarCenario(&cenario);
+    }
+    liberarMemoria(&arena, &mapa, &missoes);
+    usarRegras(&REGRAS_MESTRE);
+    soltarRegras(regrasDaPartida);
+
+    metricas.partidasAtivas = 0;
+    metricas.memoriaBytes = 0;
+    if (arquivoMetricas != NULL)
+    {
+        exportarMetricas(arquivoMetricas);
+    }
+
+    if (arquivoDeltas != NULL)
+    {
+        fclose(arquivoDeltas);
+    }
 
     return 0;
 }
@@ -0,0 +1,90 @@
+#!/bin/sh
+# COORDENADOR DE SIMULAÇÕES - WAR GAME MESTRE
+#
+# Divide um intervalo de sementes em blocos e distribui os blocos entre
+# vários processos do modo "--simular". Cada bloco só é aceito quando o
+# processo termina com sucesso; blocos de processos que falharam são
+# reenviados. Como cada partida depende apenas da sua semente, o resultado
+# final é o mesmo para qualquer quantidade de processos.
+#
+# USO: ./coordenador.sh <executavel> <semente_inicial> <jogos> [processos] [bloco] [territorios] [jogadores]
+
+set -u
+
+if [ $# -lt 3 ]; then
+    echo "Uso: $0 <executavel> <semente_inicial> <jogos> [processos] [bloco] [territorios] [jogadores]" >&2
+    exit 1
+fi
+
+EXECUTAVEL=$1
+SEMENTE_INICIAL=$2
+JOGOS=$3
+PROCESSOS=${4:-4}
+BLOCO=${5:-1000}
+TERRITORIOS=${6:-20}
+JOGADORES=${7:-4}
+TENTATIVAS=3
+
+PASTA=$(mktemp -d) || exit 1
+trap 'rm -rf "$PASTA"' EXIT
+
+export EXECUTAVEL TERRITORIOS JOGADORES PASTA
+
+tentativa=1
+while [ $tentativa -le $TENTATIVAS ]; do
+    # Lista os blocos que ainda não têm resultado
+    pendentes=""
+    inicio=$SEMENTE_INICIAL
+    fim=$((SEMENTE_INICIAL + JOGOS))
+    while [ $inicio -lt $fim ]; do
+        quantidade=$BLOCO
+        if [ $((inicio + quantidade)) -gt $fim ]; then
+            quantidade=$((fim - inicio))
+        fi
+        if [ ! -f "$PASTA/$inicio.txt" ]; then
+            pendentes="$pendentes $inicio:$quantidade"
+        fi
+        inicio=$((inicio + quantidade))
+    done
+
+    if [ -z "$pendentes" ]; then
+        break
+    fi
+
+    if [ $tentativa -gt 1 ]; then
+        echo "Reenviando blocos que falharam:$pendentes" >&2
+    fi
+
+    # Distribui os blocos pendentes entre os processos; um bloco só é
+    # publicado (.txt) se o processo que o executou terminar com sucesso
+    for bloco in $pendentes; do
+        echo "$bloco"
+    done | xargs -P "$PROCESSOS" -I{} sh -c '
+        inicio=${1%%:*}
+        quantidade=${1##*:}
+        if "$EXECUTAVEL" --simular "$inicio" "$quantidade" "$TERRITORIOS" "$JOGADORES" \
+            > "$PASTA/$inicio.tmp"; then
+            mv "$PASTA/$inicio.tmp" "$PASTA/$inicio.txt"
+        else
+            rm -f "$PASTA/$inicio.tmp"
+        fi
+    ' _ {}
+
+    tentativa=$((tentativa + 1))
+done
+
+# Junta os resultados na ordem das sementes
+falhou=0
+inicio=$SEMENTE_INICIAL
+fim=$((SEMENTE_INICIAL + JOGOS))
+while [ $inicio -lt $fim ]; do
+    if [ -f "$PASTA/$inicio.txt" ]; then
+        cat "$PASTA/$inicio.txt"
+    else
+        echo "Bloco iniciado na semente $inicio falhou após $TENTATIVAS tentativas" >&2
+        falhou=1
+    fi
+    inicio=$((inicio + BLOCO))
+done
+
+exit $falhou